@@ -0,0 +1,385 @@
+# Build-time tables for the LED driver, generated from a board description
+# (boards/*.json: pin list + wiring grid). Emits the geometry, pins[], the
+# STEPS/VALID_MASK grids, the gamma curve, the per-pixel scan entries and
+# the per-pixel GPIO register images the scan path writes. face_tables.h
+# gets the analog face: anti-aliased hands for all 60 positions, already
+# clipped to the valid pixels. Every table is re-checked after generation,
+# so a bad board file fails the build.
+# Runs as a PlatformIO pre-script (board from custom_led_board) and can
+# also be invoked directly: python gen_led_tables.py [boards/x.json [outdir]]
+# (outdir defaults to src/; the host tests generate other boards elsewhere)
+import json
+import math
+import os
+import re
+import sys
+
+DEFAULT_BOARD = os.path.join("boards", "round15.json")
+
+try:
+    Import("env")
+    ROOT  = env.subst("$PROJECT_DIR")
+    BOARD = env.GetProjectOption("custom_led_board", DEFAULT_BOARD)
+    OUT_DIR = os.path.join(ROOT, "src")
+except NameError:
+    ROOT  = os.path.dirname(os.path.abspath(__file__))
+    BOARD = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_BOARD
+    OUT_DIR = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, "src")
+
+OUT     = os.path.join(OUT_DIR, "led_tables.h")
+FACE_OUT = os.path.join(OUT_DIR, "face_tables.h")
+GAMMA   = 2.8
+NO_PAIR = 0xFF
+MAX_DIM = 32          # mono plane and row bitmaps in led_driver.c are 32-bit at most
+
+# Analog face: (name, length in face radii, stroke width in px, peak fb level)
+FACE_HANDS = (
+    ("HOUR",   0.55, 1.6, 255),
+    ("MINUTE", 0.90, 1.1, 255),
+    ("SECOND", 0.95, 0.6, 90),
+)
+FACE_POS        = 60
+FACE_MARK_LEVEL = 40
+FACE_MIN_LEVEL  = 12      # coverage below this is dropped from the tables
+FACE_SS         = 8       # supersamples per pixel edge
+
+
+def fail(msg):
+    raise SystemExit("gen_led_tables: %s: %s" % (BOARD, msg))
+
+
+def load_board(path):
+    with open(os.path.join(ROOT, path)) as f:
+        b = json.load(f)
+    rows, cols = int(b["rows"]), int(b["cols"])
+    if not (0 < rows <= MAX_DIM and 0 < cols <= MAX_DIM):
+        fail("rows/cols must be 1..%d" % MAX_DIM)
+
+    pins = []
+    for name in b["pins"]:
+        m = re.fullmatch(r"P([A-H])(\d{1,2})", name)
+        if not m or int(m.group(2)) > 15:
+            fail("bad pin name %r" % name)
+        pins.append((m.group(1), int(m.group(2))))
+    if len(set(pins)) != len(pins):
+        fail("a GPIO appears twice in pins")
+    if len(pins) >= NO_PAIR:
+        fail("too many pins for uint8_t indices")
+
+    if len(b["wiring"]) != rows:
+        fail("wiring has %d rows, expected %d" % (len(b["wiring"]), rows))
+    steps, seen = [], {}
+    for r, line in enumerate(b["wiring"]):
+        cells = line.split()
+        if len(cells) != cols:
+            fail("wiring row %d has %d cells, expected %d" % (r, len(cells), cols))
+        for c, cell in enumerate(cells):
+            if cell == ".":
+                steps.append(None)
+                continue
+            m = re.fullmatch(r"(\d+)>(\d+)", cell)
+            if not m:
+                fail("r%d c%d: bad cell %r" % (r, c, cell))
+            hi, lo = int(m.group(1)), int(m.group(2))
+            if hi >= len(pins) or lo >= len(pins) or hi == lo:
+                fail("r%d c%d: %r is not a pair of distinct pins" % (r, c, cell))
+            if (hi, lo) in seen:
+                fail("r%d c%d and r%d c%d share pin pair %d>%d" % (seen[(hi, lo)] + (r, c, hi, lo)))
+            seen[(hi, lo)] = (r, c)
+            steps.append((hi, lo))
+    return b.get("name", os.path.basename(path)), rows, cols, pins, steps
+
+
+def moder_field(pos):
+    return 3 << (2 * pos)
+
+
+def build(rows, cols, pins, steps):
+    ports = sorted(set(p for p, _ in pins))
+    scan, gpio = [], []
+    for idx, st in enumerate(steps):
+        moder = [0] * len(ports)
+        bsrr  = [0] * len(ports)
+        if st is None:
+            scan.append((NO_PAIR, NO_PAIR, idx))
+        else:
+            hi, lo = st
+            scan.append((hi, lo, idx))
+            (ph, nh), (pl, nl) = pins[hi], pins[lo]
+            moder[ports.index(ph)] |= moder_field(nh)
+            moder[ports.index(pl)] |= moder_field(nl)
+            bsrr[ports.index(ph)]  |= 1 << nh              # anode HIGH
+            bsrr[ports.index(pl)]  |= 1 << (nl + 16)       # cathode LOW
+        gpio.append((moder, bsrr))
+    valid_pix = [e[2] for e in scan if e[0] != NO_PAIR]
+    gamma = [int(round(65535.0 * (i / 255.0) ** GAMMA)) for i in range(256)]
+    aa = [int(round(255.0 * (i / 255.0) ** (1.0 / GAMMA))) for i in range(256)]
+    spans = []
+    for r in range(rows):
+        lit = [c for c in range(cols) if steps[r * cols + c] is not None]
+        spans.append((lit[0], lit[-1]) if lit else (cols, 0))
+    return ports, scan, gpio, valid_pix, gamma, aa, spans
+
+
+def check(rows, cols, pins, steps, ports, scan, gpio, valid_pix, gamma, aa, spans):
+    """Re-derive every emitted table from first principles."""
+    n = rows * cols
+    assert len(scan) == len(gpio) == len(steps) == n
+    assert valid_pix == sorted(set(valid_pix))
+    assert len(valid_pix) == sum(st is not None for st in steps) <= len(pins) * (len(pins) - 1)
+    pairs = set()
+    for idx, ((hi, lo, i), (moder, bsrr)) in enumerate(zip(scan, gpio)):
+        assert i == idx
+        if hi == NO_PAIR:
+            assert lo == NO_PAIR and not any(moder) and not any(bsrr) and idx not in valid_pix
+            continue
+        assert (hi, lo) == steps[idx] and (hi, lo) not in pairs
+        pairs.add((hi, lo))
+        lit = [(ports[k], b) for k in range(len(ports)) for b in range(16) if moder[k] >> (2 * b) & 3]
+        assert sorted(lit) == sorted([pins[hi], pins[lo]])
+        for k, (m, s) in enumerate(zip(moder, bsrr)):
+            for b in range(16):
+                field = (m >> (2 * b)) & 3
+                assert field in (0, 3)
+                assert bool(s >> b & 1) == ((ports[k], b) == pins[hi])
+                assert bool(s >> (b + 16) & 1) == ((ports[k], b) == pins[lo])
+    assert gamma[0] == 0 and gamma[255] == 65535
+    assert all(a <= b for a, b in zip(gamma, gamma[1:]))
+    assert aa[0] == 0 and aa[255] == 255 and all(a <= b for a, b in zip(aa, aa[1:]))
+    for r, (first, last) in enumerate(spans):
+        row = [steps[r * cols + c] is not None for c in range(cols)]
+        assert (first, last) == (cols, 0) if not any(row) else \
+            (row[first] and row[last] and not any(row[:first]) and not any(row[last + 1:]))
+
+
+def face_center(rows, cols):
+    return (cols - 1) / 2.0, (rows - 1) / 2.0, min(rows, cols) / 2.0 - 0.5
+
+
+def seg_dist2(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    t = ((px - ax) * dx + (py - ay) * dy) / float(dx * dx + dy * dy)
+    t = max(0.0, min(1.0, t))
+    ex, ey = ax + t * dx - px, ay + t * dy - py
+    return ex * ex + ey * ey
+
+
+def build_face(rows, cols, steps):
+    """Per hand and position: [(idx, level)] for every valid pixel it covers.
+    Coverage is the supersampled share of the pixel within width/2 of the
+    hand's centre line; level puts that share in linear light through the
+    same gamma the scan applies, so a half-covered pixel is half as bright."""
+    cx, cy, radius = face_center(rows, cols)
+    hands = []
+    for _, length, width, peak in FACE_HANDS:
+        per_pos = []
+        for p in range(FACE_POS):
+            a  = 2 * math.pi * p / FACE_POS
+            tx = cx + length * radius * math.sin(a)
+            ty = cy - length * radius * math.cos(a)
+            half2 = (width / 2.0) ** 2
+            px = []
+            for r in range(rows):
+                for c in range(cols):
+                    if steps[r * cols + c] is None:
+                        continue
+                    if seg_dist2(c, r, cx, cy, tx, ty) > (width / 2.0 + 0.75) ** 2:
+                        continue
+                    hit = 0
+                    for j in range(FACE_SS):
+                        for i in range(FACE_SS):
+                            sx = c - 0.5 + (i + 0.5) / FACE_SS
+                            sy = r - 0.5 + (j + 0.5) / FACE_SS
+                            hit += seg_dist2(sx, sy, cx, cy, tx, ty) <= half2
+                    level = int(round(peak * (hit / float(FACE_SS * FACE_SS)) ** (1.0 / GAMMA)))
+                    if level >= FACE_MIN_LEVEL:
+                        px.append((r * cols + c, level))
+            per_pos.append(px)
+        hands.append(per_pos)
+
+    marks = []
+    for h in range(12):
+        a  = 2 * math.pi * h / 12
+        mx = cx + (radius - 0.3) * math.sin(a)
+        my = cy - (radius - 0.3) * math.cos(a)
+        best = min((i for i, st in enumerate(steps) if st is not None),
+                   key=lambda i: (i % cols - mx) ** 2 + (i // cols - my) ** 2)
+        marks.append(best)
+    return hands, marks
+
+
+def check_face(rows, cols, steps, hands, marks):
+    n = rows * cols
+    for per_pos in hands:
+        assert len(per_pos) == FACE_POS
+        for px in per_pos:
+            assert px, "a hand position covers no valid pixel"
+            idxs = [i for i, _ in px]
+            assert len(set(idxs)) == len(idxs)
+            for i, lv in px:
+                assert 0 <= i < n and steps[i] is not None and FACE_MIN_LEVEL <= lv <= 255
+    assert len(set(marks)) == 12 and all(steps[i] is not None for i in marks)
+
+
+def emit_face(rows, cols, hands, marks):
+    n = rows * cols
+    flat, ofs = [], [0]
+    for per_pos in hands:
+        for px in per_pos:
+            flat.extend(px)
+            ofs.append(len(flat))
+    idx_t = "uint8_t" if n <= 256 else "uint16_t"
+    out = []
+    out.append("// Generated by gen_led_tables.py from %s - do not edit." % BOARD.replace(os.sep, "/"))
+    out.append("#pragma once")
+    out.append("#include \"led_tables.h\"")
+    out.append("")
+    out.append("#define FACE_POS         %d" % FACE_POS)
+    out.append("#define FACE_HANDS       %d   // %s" % (len(FACE_HANDS), ", ".join(h[0].lower() for h in FACE_HANDS)))
+    for k, h in enumerate(FACE_HANDS):
+        out.append("#define FACE_%-11s %d" % (h[0], k))
+    out.append("#define FACE_MARKS_N     12")
+    out.append("#define FACE_MARK_LEVEL  %d" % FACE_MARK_LEVEL)
+    out.append("")
+    out.append("typedef struct { %s idx; uint8_t level; } FacePx;" % idx_t)
+    out.append("")
+    out.append("// hand h at position p covers FACE_PX[FACE_OFS[h*FACE_POS + p] .. FACE_OFS[h*FACE_POS + p + 1])")
+    out.append("static const uint16_t FACE_OFS[FACE_HANDS * FACE_POS + 1] = {")
+    for i in range(0, len(ofs), 12):
+        out.append("  " + " ".join("%d," % o for o in ofs[i:i + 12]))
+    out.append("};")
+    out.append("")
+    out.append("static const FacePx FACE_PX[%d] = {" % len(flat))
+    for k, (name, length, width, peak) in enumerate(FACE_HANDS):
+        out.append("  // %s: %.2f R, %.1f px wide, peak %d" % (name.lower(), length, width, peak))
+        for p in range(FACE_POS):
+            px = hands[k][p]
+            out.append("  /* %2d */ %s" % (p, " ".join("{%d,%d}," % e for e in px)))
+    out.append("};")
+    out.append("")
+    out.append("// hour marks on the rim, 12 o'clock first")
+    out.append("static const %s FACE_MARKS[FACE_MARKS_N] = { %s };" % (idx_t, ", ".join("%d" % m for m in marks)))
+    out.append("")
+    return "\n".join(out)
+
+
+def emit(name, rows, cols, pins, steps, ports, scan, gpio, valid_pix, gamma, aa, spans):
+    n = rows * cols
+    out = []
+    out.append("// Generated by gen_led_tables.py from %s - do not edit." % BOARD.replace(os.sep, "/"))
+    out.append("#pragma once")
+    out.append("#include \"main.h\"")
+    out.append("")
+    out.append("#define LED_BOARD    \"%s\"" % name)
+    out.append("#define ROWS         %d" % rows)
+    out.append("#define COLS         %d" % cols)
+    out.append("#define N_PIXELS     (ROWS*COLS)")
+    out.append("#define N_PINS       %d" % len(pins))
+    out.append("#define LED_N_PORTS  %d" % len(ports))
+    out.append("#define LED_NO_PAIR  0x%02X   // ScanEntry.hi for pixels that cannot light" % NO_PAIR)
+    out.append("#define LED_N_VALID  %d" % len(valid_pix))
+    out.append("")
+    out.append("typedef struct {")
+    out.append("  GPIO_TypeDef *port;")
+    out.append("  uint8_t pos;           // pin number 0..15")
+    out.append("  uint16_t pinmask;      // (1 << pos)")
+    out.append("} Pin;")
+    out.append("")
+    out.append("static const Pin pins[N_PINS] = {")
+    for p, b in pins:
+        out.append("  {GPIO%s, %2d, GPIO_PIN_%d}," % (p, b, b))
+    out.append("};")
+    out.append("")
+    out.append("typedef struct { uint8_t hi, lo; } CP_Step;")
+    out.append("typedef struct { uint8_t hi, lo; uint16_t idx; } ScanEntry;")
+    out.append("")
+    out.append("// anode/cathode pin index per pixel; {0,0} where VALID_MASK is 0")
+    out.append("static const CP_Step STEPS[N_PIXELS] = {")
+    for r in range(rows):
+        cells = " ".join("{%d,%d}," % (st or (0, 0)) for st in steps[r * cols:(r + 1) * cols])
+        out.append("  /* r%02d */ %s" % (r, cells))
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t VALID_MASK[N_PIXELS] = {")
+    for r in range(rows):
+        out.append("  /* r%02d */ %s" % (r, ",".join("1" if st else "0" for st in steps[r * cols:(r + 1) * cols]) + ","))
+    out.append("};")
+    out.append("")
+    out.append("// (i/255)^%.1f in Q16; Led_Init scales it by the timer ARR" % GAMMA)
+    out.append("static const uint16_t LED_GAMMA_Q16[256] = {")
+    for i in range(0, 256, 8):
+        out.append("  " + " ".join("%5d," % g for g in gamma[i:i + 8]))
+    out.append("};")
+    out.append("")
+    out.append("// coverage 0..255 -> fb level whose light output is that share of 255 (anti-aliasing)")
+    out.append("static const uint8_t LED_AA_LEVEL[256] = {")
+    for i in range(0, 256, 16):
+        out.append("  " + " ".join("%3d," % a for a in aa[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("// first and last valid column per row (COLS, 0 for an empty row); VALID_MASK still rules inside")
+    out.append("static const uint8_t LED_ROW_SPAN[ROWS][2] = {")
+    out.append("  " + " ".join("{%d,%d}," % sp for sp in spans))
+    out.append("};")
+    out.append("")
+    out.append("// pixel index -> ready-to-queue active-list entry")
+    out.append("static const ScanEntry LED_SCAN[%d] = {" % n)
+    for r in range(rows):
+        cells = " ".join("{%d,%d,%d}," % e for e in scan[r * cols:(r + 1) * cols])
+        out.append("  /* r%02d */ %s" % (r, cells))
+    out.append("};")
+    out.append("")
+    out.append("// indices of every pixel that can light, in row-major order")
+    out.append("static const uint8_t LED_VALID_PIX[LED_N_VALID] = {" if n <= 256 else
+               "static const uint16_t LED_VALID_PIX[LED_N_VALID] = {")
+    for i in range(0, len(valid_pix), 16):
+        out.append("  " + " ".join("%d," % v for v in valid_pix[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("// Register images per pixel and port: the MODER fields of both pins")
+    out.append("// (output = field & 0x55555555) and the BSRR word driving them.")
+    out.append("typedef struct { uint32_t moder[LED_N_PORTS], bsrr[LED_N_PORTS]; } LedGpio;")
+    out.append("")
+    out.append("static GPIO_TypeDef *const LED_PORTS[LED_N_PORTS] = { %s };" % ", ".join("GPIO%s" % p for p in ports))
+    out.append("")
+    out.append("// Read by the scan ISR on every slot, so keep a copy in SRAM.")
+    out.append("static const LedGpio LED_GPIO[N_PIXELS] RAMDATA(led_gpio) = {")
+    for idx, (moder, bsrr) in enumerate(gpio):
+        if not any(moder):
+            continue
+        out.append("  [%3d] = {{%s}, {%s}}," % (idx, ", ".join("0x%08X" % m for m in moder),
+                                                ", ".join("0x%08X" % s for s in bsrr)))
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    name, rows, cols, pins, steps = load_board(BOARD)
+    tables = build(rows, cols, pins, steps)
+    try:
+        check(rows, cols, pins, steps, *tables)
+    except AssertionError:
+        fail("generated tables failed self-check")
+    hands, marks = build_face(rows, cols, steps)
+    try:
+        check_face(rows, cols, steps, hands, marks)
+    except AssertionError:
+        fail("generated face tables failed self-check")
+
+    write(OUT, emit(name, rows, cols, pins, steps, *tables),
+          "%s, %dx%d, %d pins" % (name, rows, cols, len(pins)))
+    write(FACE_OUT, emit_face(rows, cols, hands, marks),
+          "%d hand pixels" % sum(len(px) for per_pos in hands for px in per_pos))
+
+
+def write(path, text, what):
+    old = open(path).read() if os.path.exists(path) else None
+    if text != old:                      # leave the mtime alone when unchanged
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(text)
+        print("gen_led_tables: wrote %s (%s)" % (path, what))
+
+
+main()
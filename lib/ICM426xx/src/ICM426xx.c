@@ -3,108 +3,372 @@
 #include <string.h>
 #include <math.h>
 #include "ICM426xx.h"
+#ifdef LED_BENCH
+#include "profile.h"
+#endif
 
 
 
 static void cs_low(void);
 static void cs_high(void);
 
-static void write_single_ICM426xx_reg(uint8_t reg, uint8_t val)
+static volatile bool xfer_busy;    // a DMA transfer owns SPI1 and CS
+static uint8_t cur_bank = 0xFF;    // REG_BANK_SEL shadow; 0xFF = unknown
+
+// Address byte then zeros: the MOSI side of every read, blocking or DMA
+static uint8_t xfer_tx[1 + ICM426xx_XFER_MAX];
+static uint8_t burst_rx[1 + ICM426xx_XFER_MAX];
+
+// Blocking accesses wait out a queued transfer; thread context only
+static inline void spi_idle(void)
+{
+    while (xfer_busy) { }
+}
+
+// ---- Register access: one full-duplex transaction each ----
+static void spi_write(uint8_t reg, uint8_t val)
 {
     uint8_t tx[2] = { WRITE | reg, val };
+    uint8_t rx[2];
+    spi_idle();
     cs_low();
-    HAL_SPI_Transmit(ICM426xx_SPI, tx, 2, HAL_MAX_DELAY);
+    HAL_SPI_TransmitReceive(ICM426xx_SPI, tx, rx, 2, HAL_MAX_DELAY);
     cs_high();
 }
 
+// ---- Bank switching ----
+static void set_bank(uint8_t bank)
+{
+    if (bank == cur_bank) return;
+    spi_write(B0_REG_BANK_SEL, bank);
+    cur_bank = bank;
+}
+
+static void write_bank_reg(uint8_t bank, uint8_t reg, uint8_t val)
+{
+    set_bank(bank);
+    spi_write(reg, val);
+    if (bank == 0 && reg == B0_DEVICE_CONFIG && (val & 0x01))
+        cur_bank = 0;              // soft reset puts REG_BANK_SEL back to 0
+}
+
+static void write_single_ICM426xx_reg(uint8_t reg, uint8_t val)
+{
+    write_bank_reg(0, reg, val);
+}
+
 static uint8_t read_single_ICM426xx_reg(uint8_t reg)
 {
-    uint8_t tx = READ | reg;
-    uint8_t rx = 0;
+    uint8_t tx[2] = { READ | reg, 0 };
+    uint8_t rx[2] = { 0, 0 };
+    set_bank(0);
+    spi_idle();
     cs_low();
-    HAL_SPI_Transmit(ICM426xx_SPI, &tx, 1, HAL_MAX_DELAY);
-    HAL_SPI_Receive(ICM426xx_SPI, &rx, 1, HAL_MAX_DELAY);
+    HAL_SPI_TransmitReceive(ICM426xx_SPI, tx, rx, 2, HAL_MAX_DELAY);
     cs_high();
-    return rx;
+    return rx[1];
 }
 
-static void read_multi(uint8_t reg, uint8_t *buf, uint16_t len)
+// Burst read; the bytes are valid until the next burst
+static const uint8_t *read_bank_burst(uint8_t bank, uint8_t reg, uint16_t len)
 {
-    uint8_t tx = READ | reg;
+    set_bank(bank);
+    spi_idle();
+    xfer_tx[0] = READ | reg;
     cs_low();
-    HAL_SPI_Transmit(ICM426xx_SPI, &tx, 1, HAL_MAX_DELAY);
-    HAL_SPI_Receive(ICM426xx_SPI, buf, len, HAL_MAX_DELAY);
+    HAL_SPI_TransmitReceive(ICM426xx_SPI, xfer_tx, burst_rx, (uint16_t)(len + 1), HAL_MAX_DELAY);
     cs_high();
+    return burst_rx + 1;
 }
 
-// ---- Bank switching ----
-static void set_bank(uint8_t bank)
+static const uint8_t *read_burst(uint8_t reg, uint16_t len)
 {
-    write_single_ICM426xx_reg(0x76, bank); // REG_BANK_SEL
+    return read_bank_burst(0, reg, len);
 }
 
 static void cs_low(void)  { HAL_GPIO_WritePin(ICM426xx_SPI_CS_PIN_PORT, ICM426xx_SPI_CS_PIN_NUMBER, GPIO_PIN_RESET); }
 static void cs_high(void) { HAL_GPIO_WritePin(ICM426xx_SPI_CS_PIN_PORT, ICM426xx_SPI_CS_PIN_NUMBER, GPIO_PIN_SET); }
 
 
-// ---- Initialization ----
-void ICM426xx_init(void)
+// ---- Asynchronous reads (SPI1 DMA) ----
+// One transfer at a time: address byte plus len clocked-out zeros, CS held
+// low until HAL_SPI_TxRxCpltCallback hands control back here.
+
+static uint8_t dma_rx[1 + ICM426xx_XFER_MAX];
+static ICM426xx_XferDone xfer_done;
+static uint16_t xfer_len;
+#ifdef LED_BENCH
+static uint32_t cb_cycles;         // CPU time spent in completion callbacks
+#endif
+
+bool ICM426xx_ReadAsync(uint8_t reg, uint16_t len, ICM426xx_XferDone done)
 {
-    // Reset + bank select
-    write_single_ICM426xx_reg(B0_DEVICE_CONFIG, 0x01);
-    HAL_Delay(10);
-    write_single_ICM426xx_reg(B0_REG_BANK_SEL, 0x00);
+    if (xfer_busy || !len || len > ICM426xx_XFER_MAX) return false;
 
-    // Power accel + gyro
-    write_single_ICM426xx_reg(B0_PWR_MGMT0, 0x0A);
-    write_single_ICM426xx_reg(B0_ACCEL_CONFIG0, 0x09); // accel ODR=50 Hz, ±2g
-    write_single_ICM426xx_reg(B0_GYRO_CONFIG0, 0x09); // gyro ODR=50 Hz, ±250 dps
+    set_bank(0);
+    xfer_busy = true;
+    xfer_done = done;
+    xfer_len  = len;
+    xfer_tx[0] = READ | reg;
+    cs_low();
+    if (HAL_SPI_TransmitReceive_DMA(ICM426xx_SPI, xfer_tx, dma_rx, (uint16_t)(len + 1)) != HAL_OK) {
+        cs_high();
+        xfer_busy = false;
+        return false;
+    }
+    return true;
+}
 
-    // INT1: active high, push-pull, pulsed
-    // bit2 = 0 (pulsed)
-    // bit1 = 1 (push-pull)
-    // bit0 = 1 (active high)
-    write_single_ICM426xx_reg(B0_INT_CONFIG, 0x03);
+bool ICM426xx_XferBusy(void)
+{
+    return xfer_busy;
+}
 
-    write_single_ICM426xx_reg(B0_INT_CONFIG0, 0x00);
-    write_single_ICM426xx_reg(B0_INT_CONFIG1, 0x00);
+void ICM426xx_SpiComplete(SPI_HandleTypeDef *hspi, bool ok)
+{
+    if (hspi != ICM426xx_SPI || !xfer_busy) return;
+#ifdef LED_BENCH
+    uint32_t t0 = Profile_Cycles();
+#endif
+    cs_high();
+    xfer_busy = false;             // done() may queue the next transfer
+    ICM426xx_XferDone done = xfer_done;
+    if (done) done(ok ? dma_rx + 1 : NULL, xfer_len);
+#ifdef LED_BENCH
+    cb_cycles += Profile_Cycles() - t0;
+#endif
+}
 
-    // Enable WOM interrupt routing
-    write_single_ICM426xx_reg(B0_INT_SOURCE0, 0x00);
-    write_single_ICM426xx_reg(B0_INT_SOURCE1, 0x0F);
-    write_single_ICM426xx_reg(B0_INT_SOURCE2, 0x00);
-    write_single_ICM426xx_reg(B0_INT_SOURCE3, 0x00);
+// ---- Initialization ----
+// Applied in order, one transaction per entry; bank changes only cost a
+// REG_BANK_SEL write when the bank actually changes. delay_ms must pass
+// before the next entry.
+typedef struct { uint8_t bank, reg, val, delay_ms; } RegInit;
+
+#define APEX_EVENTS_ALL  (ICM426xx_APEX_TILT | ICM426xx_APEX_WAKE | ICM426xx_APEX_SLEEP | \
+                          ICM426xx_APEX_TAP)
+
+static const RegInit INIT_TABLE[] = {
+    { 0, B0_DEVICE_CONFIG,     0x01, 1 },  // soft reset, 1 ms before the next access
+    { 0, B0_ACCEL_CONFIG0,     0x67, 0 },  // ±2g, 200 Hz: comes up in ICM426xx_PROFILE_APEX
+    { 0, B0_GYRO_CONFIG0,      0x69, 0 },  // ±250 dps, 50 Hz, off for now
+    { 0, B0_INT_CONFIG,        0x03, 0 },  // INT1: pulsed, push-pull, active high
+    { 0, B0_INT_CONFIG0,       0x00, 0 },
+    { 0, B0_INT_CONFIG1,       0x00, 0 },  // INT_ASYNC_RESET off, as the datasheet asks
+    { 0, B0_INT_SOURCE0,       0x00, 0 },  // drop the reset-done source
+    { 0, B0_TMST_CONFIG,       0x23, 0 },  // 1 us ODR timestamp in each FIFO packet
+    { 0, B0_PWR_MGMT0,         0x02, 1 },  // accel low power; 200 us without writes
+    // APEX in the datasheet's order: DMP rate, DMP memory reset, feature
+    // parameters, DMP init, INT1 routing, then the features themselves
+    { 0, B0_APEX_CONFIG0,      0x00, 1 },  // DMP at 25 Hz on every sample, features off
+    { 0, B0_SIGNAL_PATH_RESET, 0x20, 1 },  // DMP_MEM_RESET_EN
+    { 4, B4_APEX_CONFIG4,      0x40, 0 },  // tilt held 2 s; lowered wrist sleeps after 1.28 s
+    { 4, B4_APEX_CONFIG7,      0x45, 0 },  // tap: min jerk 17, peak tolerance 1
+    { 4, B4_APEX_CONFIG8,      0x5B, 1 },  // tap: tmax 2, tavg 3, tmin 3 (datasheet defaults)
+    { 0, B0_SIGNAL_PATH_RESET, 0x40, 0 },  // DMP_INIT_EN
+    { 4, B4_INT_SOURCE6,       APEX_EVENTS_ALL, 50 },  // → INT1; DMP settles before enabling
+    { 0, B0_APEX_CONFIG0,      0x58, 0 },  // TAP_ENABLE | TILT_ENABLE | R2W_EN
+};
+#define INIT_LEN  (sizeof INIT_TABLE / sizeof INIT_TABLE[0])
+
+static ICM426xx_Profile cur_profile = ICM426xx_PROFILE_COUNT;   // none until ready
+static bool     settling;          // a sensor is starting up; its data is not valid
+static uint32_t settle_due;        // tick it is over at
+static bool     fifo_t_valid;      // FIFO timestamp chain, see FIFO batching
+static uint8_t apex_route;            // INT_SOURCE6 as last written
+
+/* Non-blocking: ICM426xx_InitStep writes entries until one asks for a
+   wait, then returns. Motion data counts as valid once the accel has had
+   its start-up time after the table. */
+static enum { INIT_OFF, INIT_RUN, INIT_SETTLE, INIT_READY } init_state;
+static uint8_t  init_idx;             // next table entry
+static uint32_t init_due;             // tick the next step may run at
+#ifdef LED_BENCH
+static uint32_t ready_tick;
+#endif
+
+void ICM426xx_InitStart(void)
+{
+    cur_bank   = 0xFF;                // unknown until the first write
+    init_idx   = 0;
+    init_due   = HAL_GetTick();
+    init_state = INIT_RUN;
+    cur_profile = ICM426xx_PROFILE_COUNT;
+}
 
-    // WOM config: differential mode, accel enabled
-	write_single_ICM426xx_reg(B0_SMD_CONFIG, 0x0B);  
-    HAL_Delay(10);
+bool ICM426xx_InitStep(void)
+{
+    uint32_t now = HAL_GetTick();
+
+    switch (init_state) {
+    case INIT_RUN:
+        if ((int32_t)(now - init_due) < 0) return false;
+        while (init_idx < INIT_LEN) {
+            const RegInit *e = &INIT_TABLE[init_idx++];
+            write_bank_reg(e->bank, e->reg, e->val);
+            if (e->delay_ms) {
+                init_due = now + e->delay_ms + 1;   // whole-ms ticks: d ms is d + 1 away
+                return false;
+            }
+        }
+        init_due   = now + ICM426xx_ACCEL_STARTUP_MS;
+        init_state = INIT_SETTLE;
+        return false;
+
+    case INIT_SETTLE:
+        if ((int32_t)(now - init_due) < 0) return false;
+        init_state  = INIT_READY;
+        cur_profile = ICM426xx_PROFILE_APEX;
+        settling    = false;
+        apex_route  = APEX_EVENTS_ALL;
+#ifdef LED_BENCH
+        ready_tick = now;
+#endif
+        return true;
+
+    case INIT_READY:
+        return true;
+
+    default:
+        return false;
+    }
+}
 
-    // Switch to Bank 4 for WOM thresholds
-    write_single_ICM426xx_reg(B0_REG_BANK_SEL, 0x04);
-    write_single_ICM426xx_reg(0x4A, 0xFF);
-    write_single_ICM426xx_reg(0x4B, 0x30);
-    write_single_ICM426xx_reg(0x4C, 0xFF);
-    HAL_Delay(10);
+bool ICM426xx_Ready(void)
+{
+    return init_state == INIT_READY;
+}
+
+void ICM426xx_init(void)
+{
+    ICM426xx_InitStart();
+    while (!ICM426xx_InitStep()) { }
+}
+
+#ifdef LED_BENCH
+uint32_t ICM426xx_BenchReadyTick(void)
+{
+    return ready_tick;
+}
+#endif
+
+
+// ---- Power / ODR profiles ----
+// Switched in place: ODR and full scale first, PWR_MGMT0 last, then the
+// 200 us the datasheet asks for before the next write; a sensor that was
+// off then has its start-up time to go (ICM426xx_Settled). APEX and interrupt
+// routing are left as they are; APEX runs whenever the accel does. Currents are typical datasheet figures at
+// 1.8 V, good for comparing profiles rather than for a battery budget.
+typedef struct {
+    uint8_t  pwr_mgmt0;            // GYRO_MODE[3:2] ACCEL_MODE[1:0]
+    uint8_t  accel_config0;        // FS_SEL[7:5] ODR[3:0]
+    uint8_t  gyro_config0;
+    uint16_t odr_ms;               // sample period of the FIFO records, 0 when off
+    uint32_t ua;
+} ProfileRegs;
+
+static const ProfileRegs PROFILES[ICM426xx_PROFILE_COUNT] = {
+    [ICM426xx_PROFILE_OFF]         = { 0x00, 0x6B, 0x69,  0,   8 },  // sleep
+    [ICM426xx_PROFILE_APEX]        = { 0x02, 0x67, 0x69,  5,  55 },  // accel LP 200 Hz
+    [ICM426xx_PROFILE_ACCEL_LP_50] = { 0x02, 0x69, 0x69, 20,  35 },  // accel LP 50 Hz
+    [ICM426xx_PROFILE_LN_200]      = { 0x0F, 0x67, 0x67,  5, 880 },  // accel + gyro LN 200 Hz
+};
+#define PWR_GYRO_MODE   0x0C
+#define PWR_ACCEL_MODE  0x03
+
+
+void ICM426xx_SetProfile(ICM426xx_Profile p)
+{
+    if (p >= ICM426xx_PROFILE_COUNT || p == cur_profile || init_state != INIT_READY) return;
+    const ProfileRegs *r = &PROFILES[p];
+    uint8_t was = PROFILES[cur_profile].pwr_mgmt0;
+
+    uint32_t wait = 0;
+    if ((r->pwr_mgmt0 & PWR_GYRO_MODE) && !(was & PWR_GYRO_MODE))
+        wait = ICM426xx_GYRO_STARTUP_MS;
+    else if ((r->pwr_mgmt0 & PWR_ACCEL_MODE) && !(was & PWR_ACCEL_MODE))
+        wait = ICM426xx_ACCEL_STARTUP_MS;
+
+    write_single_ICM426xx_reg(B0_ACCEL_CONFIG0, r->accel_config0);
+    write_single_ICM426xx_reg(B0_GYRO_CONFIG0,  r->gyro_config0);
+    write_single_ICM426xx_reg(B0_PWR_MGMT0,     r->pwr_mgmt0);
+    HAL_Delay(1);
+    cur_profile = p;
+
+    if (wait) {
+        uint32_t due = HAL_GetTick() + wait + 1;         // whole-ms ticks
+        if (!settling || (int32_t)(due - settle_due) > 0) settle_due = due;
+        settling = true;
+    }
+}
+
+// The first call past the deadline flushes the start-up samples, so the
+// FIFO readers (which all ask here first) never see one
+bool ICM426xx_Settled(void)
+{
+    if (!settling) return true;
+    if ((int32_t)(HAL_GetTick() - settle_due) < 0) return false;
+    settling = false;
+    write_single_ICM426xx_reg(B0_SIGNAL_PATH_RESET, 0x02);   // FIFO_FLUSH
+    fifo_t_valid = false;
+    return true;
+}
 
-    // Back to Bank 0
-    write_single_ICM426xx_reg(B0_REG_BANK_SEL, 0x00);
+ICM426xx_Profile ICM426xx_GetProfile(void)
+{
+    return cur_profile;
+}
 
-    HAL_Delay(50);
+uint32_t ICM426xx_ProfileCurrent_uA(ICM426xx_Profile p)
+{
+    return p < ICM426xx_PROFILE_COUNT ? PROFILES[p].ua : 0;
 }
 
 
 float ICM426xx_testReturn(void) {
-    int16_t ax_raw = (read_single_ICM426xx_reg(B0_ACCEL_DATA_X1_UI) << 8) |
-                     read_single_ICM426xx_reg(B0_ACCEL_DATA_X0_UI);
+    const uint8_t *b = read_burst(B0_ACCEL_DATA_X1_UI, 2);
+    int16_t ax_raw = (int16_t)((b[0] << 8) | b[1]);
     return (float)ax_raw / accel_lsb_per_g;
 }
 
 
-static ICM426xx_Sample sample;
+static ICM426xx_Sample    sample;
+static ICM426xx_SampleRaw sample_raw;
+
+static inline int16_t be16(const uint8_t *p)
+{
+    return (int16_t)((p[0] << 8) | p[1]);
+}
+
+// ACCEL_DATA_X1..GYRO_DATA_Z0 order: six big-endian words, accel first
+static void raw_from_regs(const uint8_t *b, ICM426xx_SampleRaw *r)
+{
+    r->ax = be16(b + 0);
+    r->ay = be16(b + 2);
+    r->az = be16(b + 4);
+    r->gx = be16(b + 6);
+    r->gy = be16(b + 8);
+    r->gz = be16(b + 10);
+    r->accel_fsr_g  = ICM426xx_ACCEL_FSR_G;
+    r->gyro_fsr_dps = ICM426xx_GYRO_FSR_DPS;
+}
+
+void ICM426xx_RawToSample(const ICM426xx_SampleRaw *r, ICM426xx_Sample *s)
+{
+    float ka = r->accel_fsr_g  * (1.0f / 32768.0f);     // g per LSB
+    float kg = r->gyro_fsr_dps * (1.0f / 32768.0f);     // dps per LSB
+    s->ax = r->ax * ka;
+    s->ay = r->ay * ka;
+    s->az = r->az * ka;
+    s->gx = r->gx * kg;
+    s->gy = r->gy * kg;
+    s->gz = r->gz * kg;
+    s->ts = r->ts;
+}
 
 uint8_t ICM426xx_interruptStatus(void)
 {
-    // INT_STATUS (Bank 0, 0x2D) holds WOM / SMD / FIFO / Data Ready flags
+    // INT_STATUS (Bank 0, 0x2D) holds FIFO / Data Ready flags
     uint8_t status = read_single_ICM426xx_reg(B0_INT_STATUS);
 
     // Reading INT_STATUS clears the latched interrupt
@@ -114,8 +378,6 @@ uint8_t ICM426xx_interruptStatus(void)
 
 // ---- Main loop: read + parse one packet ----
 void ICM426xx_loop(void) {
-    uint8_t buf[12];
-
     // Burst read accel + gyro: 0x1F = ACCEL_DATA_X1_UI
     // Register map:
     // 0x1F: ACCEL_X1, 0x20: ACCEL_X0
@@ -124,32 +386,436 @@ void ICM426xx_loop(void) {
     // 0x25: GYRO_X1,  0x26: GYRO_X0
     // 0x27: GYRO_Y1,  0x28: GYRO_Y0
     // 0x29: GYRO_Z1,  0x2A: GYRO_Z0
-    read_multi(0x1F, buf, 12);
+    const uint8_t *buf = read_burst(B0_ACCEL_DATA_X1_UI, 12);
+    raw_from_regs(buf, &sample_raw);
 
-    int16_t ax = (int16_t)((buf[0] << 8) | buf[1]);
-    int16_t ay = (int16_t)((buf[2] << 8) | buf[3]);
-    int16_t az = (int16_t)((buf[4] << 8) | buf[5]);
+    // No timestamp in this mode, so just use system tick
+    sample_raw.ts = HAL_GetTick();
+    ICM426xx_RawToSample(&sample_raw, &sample);
+}
 
-    int16_t gx = (int16_t)((buf[6] << 8) | buf[7]);
-    int16_t gy = (int16_t)((buf[8] << 8) | buf[9]);
-    int16_t gz = (int16_t)((buf[10] << 8) | buf[11]);
+// ---- FIFO batching ----
+// Stream mode, packet 3 (header, accel, gyro, temp, 16-bit ODR timestamp),
+// FIFO_COUNT in records. INT1 pulses when the count passes the watermark,
+// so the MCU only wakes once per batch. The packet timestamp is the
+// sensor's 1 us counter at the sample's ODR tick: ts is when the sample was
+// taken, however late the MCU gets to it. It stays continuous across
+// batches as long as the FIFO never overruns (2 KB, 0.6 s at 200 Hz);
+// ICM426xx_FifoEnable restarts it.
+
+static uint16_t fifo_t16;          // last 16-bit FIFO timestamp seen
+static uint32_t fifo_us;           // its unwrapped value, while fifo_t_valid
+static volatile bool     fifo_rx_ready;   // an async batch waits in dma_rx
+static volatile uint16_t fifo_rx_len;
+
+void ICM426xx_FifoEnable(uint16_t watermark)
+{
+    if (watermark < 1) watermark = 1;
+    if (watermark > ICM426xx_FIFO_BATCH_MAX) watermark = ICM426xx_FIFO_BATCH_MAX;
+
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG, 0x00);      // bypass while reconfiguring
+    write_single_ICM426xx_reg(B0_INTF_CONFIG0, 0x70);     // count in records, big endian
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG1, 0x27);     // WM_GT_TH | temp | gyro | accel
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG2, (uint8_t)(watermark & 0xFF));
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG3, (uint8_t)((watermark >> 8) & 0x0F));
+    write_single_ICM426xx_reg(B0_SIGNAL_PATH_RESET, 0x02); // FIFO_FLUSH
+    write_single_ICM426xx_reg(B0_INT_SOURCE0, 0x04);      // FIFO_THS → INT1
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG, 0x40);      // stream-to-FIFO
+
+    fifo_t_valid  = false;
+    fifo_rx_ready = false;                                // drop a stale batch
+}
 
-    // Convert to float using sensitivity constants
-    sample.ax = (float)ax / accel_lsb_per_g;       // ±2g → 16384 LSB/g
-    sample.ay = (float)ay / accel_lsb_per_g;
-    sample.az = (float)az / accel_lsb_per_g;
+void ICM426xx_FifoDisable(void)
+{
+    write_single_ICM426xx_reg(B0_INT_SOURCE0, 0x00);
+    write_single_ICM426xx_reg(B0_FIFO_CONFIG, 0x00);      // bypass
+    write_single_ICM426xx_reg(B0_SIGNAL_PATH_RESET, 0x02);
+}
 
-    sample.gx = (float)gx / gyro_lsb_per_dps;      // ±250 dps → 131 LSB/dps
-    sample.gy = (float)gy / gyro_lsb_per_dps;
-    sample.gz = (float)gz / gyro_lsb_per_dps;
+// One packet into *r; returns its size, 0 where parsing has to stop
+static uint16_t fifo_packet(const uint8_t *buf, uint16_t len, ICM426xx_SampleRaw *r)
+{
+    uint8_t hdr = buf[0];
+    if (hdr & 0x80) return 0;                               // HEADER_MSG: FIFO empty
+
+    bool has_a = hdr & 0x40, has_g = hdr & 0x20;
+    uint16_t size = (hdr & 0x10) ? 20 : (has_a && has_g) ? 16 : 8;
+    if (!has_a && !has_g) return 0;                         // not a data packet
+    if (size > len) return 0;                               // truncated tail
+
+    // accel follows the header, gyro follows accel (packet 2: gyro first)
+    const uint8_t *a = buf + 1;
+    const uint8_t *g = has_a ? buf + 7 : buf + 1;
+
+    r->ax = has_a ? be16(a + 0) : 0;
+    r->ay = has_a ? be16(a + 2) : 0;
+    r->az = has_a ? be16(a + 4) : 0;
+    r->gx = has_g ? be16(g + 0) : 0;
+    r->gy = has_g ? be16(g + 2) : 0;
+    r->gz = has_g ? be16(g + 4) : 0;
+    r->accel_fsr_g  = ICM426xx_ACCEL_FSR_G;
+    r->gyro_fsr_dps = ICM426xx_GYRO_FSR_DPS;
+
+    // Only packets 3/4 carry a timestamp: after the 1-byte temperature of
+    // packet 3, after the 2-byte one of packet 4 (hi-res, never enabled by
+    // FIFO_CONFIG1 but parsed). It wraps every 65.5 ms, so the running µs
+    // count is extended by the difference to the last one
+    if (size >= 16) {
+        const uint8_t *t = buf + (size == 20 ? 15 : 14);
+        uint16_t t16 = (uint16_t)((t[0] << 8) | t[1]);
+        if (fifo_t_valid) fifo_us += (uint16_t)(t16 - fifo_t16);
+        else              fifo_us = t16;
+        fifo_t16 = t16;
+        fifo_t_valid = true;
+    }
+    r->ts = fifo_us;
+    return size;
+}
 
-    // No timestamp in this mode, so just use system tick
-    sample.ts = HAL_GetTick();
+uint16_t ICM426xx_FifoParseRaw(const uint8_t *buf, uint16_t len, ICM426xx_SampleRaw *out, uint16_t max)
+{
+    uint16_t n = 0, size;
+
+    while (len && n < max && (size = fifo_packet(buf, len, &out[n])) != 0) {
+        buf += size;
+        len -= size;
+        ++n;
+    }
+    return n;
+}
+
+uint16_t ICM426xx_FifoParse(const uint8_t *buf, uint16_t len, ICM426xx_Sample *out, uint16_t max)
+{
+    uint16_t n = 0, size;
+    ICM426xx_SampleRaw r;
+
+    while (len && n < max && (size = fifo_packet(buf, len, &r)) != 0) {
+        ICM426xx_RawToSample(&r, &out[n]);
+        buf += size;
+        len -= size;
+        ++n;
+    }
+    return n;
+}
+
+uint16_t ICM426xx_FifoRead(ICM426xx_Sample *out, uint16_t max)
+{
+    if (!ICM426xx_Settled()) return 0;
+
+    const uint8_t *cnt = read_burst(B0_FIFO_COUNTH, 2);
+    uint16_t records = (uint16_t)((cnt[0] << 8) | cnt[1]);
+
+    if (records > max) records = max;
+    if (records > ICM426xx_FIFO_BATCH_MAX) records = ICM426xx_FIFO_BATCH_MAX;
+    if (!records) return 0;
+
+    // One burst: FIFO_DATA pops a byte per read without advancing the address
+    const uint8_t *data = read_burst(B0_FIFO_DATA, (uint16_t)(records * ICM426xx_FIFO_PACKET_LEN));
+    uint16_t n = ICM426xx_FifoParse(data, (uint16_t)(records * ICM426xx_FIFO_PACKET_LEN), out, max);
+    if (n) sample = out[n - 1];
+    return n;
+}
+
+/* Asynchronous drain: FIFO_COUNT, then FIFO_DATA chained from the first
+   completion. The packets stay in dma_rx until ICM426xx_FifoCollect parses
+   them, so no new drain starts until the batch is collected. */
+
+static void fifo_data_done(const uint8_t *rx, uint16_t len)
+{
+    fifo_rx_len   = rx ? len : 0;
+    fifo_rx_ready = true;
+}
+
+static void fifo_count_done(const uint8_t *rx, uint16_t len)
+{
+    uint16_t records = rx ? (uint16_t)((rx[0] << 8) | rx[1]) : 0;
+    if (records > ICM426xx_FIFO_BATCH_MAX) records = ICM426xx_FIFO_BATCH_MAX;
+
+    if (!records ||
+        !ICM426xx_ReadAsync(B0_FIFO_DATA, (uint16_t)(records * ICM426xx_FIFO_PACKET_LEN), fifo_data_done)) {
+        fifo_rx_len   = 0;
+        fifo_rx_ready = true;
+    }
+}
+
+bool ICM426xx_FifoReadAsync(void)
+{
+    if (fifo_rx_ready) return false;       // last batch not collected yet
+    if (!ICM426xx_Settled()) return false;
+    return ICM426xx_ReadAsync(B0_FIFO_COUNTH, 2, fifo_count_done);
 }
 
+uint16_t ICM426xx_FifoCollect(ICM426xx_Sample *out, uint16_t max)
+{
+    if (!fifo_rx_ready) return 0;
+    fifo_rx_ready = false;
+
+    uint16_t n = ICM426xx_FifoParse(dma_rx + 1, fifo_rx_len, out, max);
+    if (n) sample = out[n - 1];
+    return n;
+}
+
+uint16_t ICM426xx_FifoCollectRaw(ICM426xx_SampleRaw *out, uint16_t max)
+{
+    if (!fifo_rx_ready) return 0;
+    fifo_rx_ready = false;
+
+    uint16_t n = ICM426xx_FifoParseRaw(dma_rx + 1, fifo_rx_len, out, max);
+    if (n) {
+        sample_raw = out[n - 1];
+        ICM426xx_RawToSample(&sample_raw, &sample);
+    }
+    return n;
+}
+
+// ---- Gravity fusion ----
+/* Mahony on the gravity direction v alone: in sensor axes a fixed world
+   vector turns as dv/dt = v x w, and the accel error e = a x v added to
+   the gyro rate w pulls v toward a (v x (a x v) = a - v (v.a)). One
+   first-order step per sample, then v *= (3 - |v|^2) / 2 keeps it unit
+   length without a square root. The fixed version has no division other
+   than dt: Q28 vectors, Q24 rates, 64-bit products. */
+#define Q28_ONE        (1LL << 28)
+#define GYRO_RAD_Q12   36602                      // pi / 180 * 2^24 / 32768, Q12
+#define FUSION_KP_Q16  ((int64_t)(ICM426xx_FUSION_KP * 65536.0f))
+#define FUSION_KI_Q16  ((int64_t)(ICM426xx_FUSION_KI * 65536.0f))
+#define GATE_LO_Q48    ((int64_t)((1.0 - ICM426xx_FUSION_GATE_G) * (1.0 - ICM426xx_FUSION_GATE_G) * 281474976710656.0))
+#define GATE_HI_Q48    ((int64_t)((1.0 + ICM426xx_FUSION_GATE_G) * (1.0 + ICM426xx_FUSION_GATE_G) * 281474976710656.0))
+
+static inline int32_t mul_q28(int32_t a, int32_t b)
+{
+    return (int32_t)(((int64_t)a * b) >> 28);
+}
+
+static void renorm_q28(ICM426xx_Gravity *g)
+{
+    int32_t n2 = (int32_t)(((int64_t)g->x * g->x + (int64_t)g->y * g->y + (int64_t)g->z * g->z) >> 28);
+    int32_t f  = (int32_t)((3 * Q28_ONE - n2) >> 1);
+    g->x = mul_q28(g->x, f);
+    g->y = mul_q28(g->y, f);
+    g->z = mul_q28(g->z, f);
+}
+
+void ICM426xx_GravityUpdate(ICM426xx_Gravity *g, const ICM426xx_SampleRaw *r, uint32_t dt_us)
+{
+    // accel in g, Q24 (±16 g fits); |a|^2 in Q48
+    int32_t ax = ((int32_t)r->ax * r->accel_fsr_g) << 9;
+    int32_t ay = ((int32_t)r->ay * r->accel_fsr_g) << 9;
+    int32_t az = ((int32_t)r->az * r->accel_fsr_g) << 9;
+    int64_t a2 = (int64_t)ax * ax + (int64_t)ay * ay + (int64_t)az * az;
+    bool    rest = a2 > GATE_LO_Q48 && a2 < GATE_HI_Q48;
+
+    if (!g->primed) {
+        g->bx = g->by = g->bz = 0;
+        if (rest) { g->x = ax << 4; g->y = ay << 4; g->z = az << 4; }
+        else      { g->x = 0;       g->y = 0;       g->z = (int32_t)Q28_ONE; }
+        for (uint8_t i = 0; i < 3; ++i) renorm_q28(g);
+        g->primed = true;
+        return;
+    }
+
+    // e = a x v, Q28; zero while the accel is not just gravity
+    int32_t ex = 0, ey = 0, ez = 0;
+    if (rest) {
+        ex = (int32_t)(((int64_t)ay * g->z - (int64_t)az * g->y) >> 24);
+        ey = (int32_t)(((int64_t)az * g->x - (int64_t)ax * g->z) >> 24);
+        ez = (int32_t)(((int64_t)ax * g->y - (int64_t)ay * g->x) >> 24);
+    }
+
+    int32_t dt = (int32_t)(((uint64_t)dt_us << 28) / 1000000u);     // s, Q28
+    g->bx += (int32_t)((((FUSION_KI_Q16 * ex) >> 20) * dt) >> 28);
+    g->by += (int32_t)((((FUSION_KI_Q16 * ey) >> 20) * dt) >> 28);
+    g->bz += (int32_t)((((FUSION_KI_Q16 * ez) >> 20) * dt) >> 28);
+
+    // corrected rate (rad/s, Q24), then the angle over dt (rad, Q28)
+    int32_t k  = r->gyro_fsr_dps * GYRO_RAD_Q12;
+    int32_t wx = (int32_t)(((int64_t)r->gx * k) >> 12) + (int32_t)((FUSION_KP_Q16 * ex) >> 20) + g->bx;
+    int32_t wy = (int32_t)(((int64_t)r->gy * k) >> 12) + (int32_t)((FUSION_KP_Q16 * ey) >> 20) + g->by;
+    int32_t wz = (int32_t)(((int64_t)r->gz * k) >> 12) + (int32_t)((FUSION_KP_Q16 * ez) >> 20) + g->bz;
+    int32_t dx = (int32_t)(((int64_t)wx * dt) >> 24);
+    int32_t dy = (int32_t)(((int64_t)wy * dt) >> 24);
+    int32_t dz = (int32_t)(((int64_t)wz * dt) >> 24);
+
+    // v += v x d
+    int32_t x = g->x, y = g->y, z = g->z;
+    g->x = x + mul_q28(y, dz) - mul_q28(z, dy);
+    g->y = y + mul_q28(z, dx) - mul_q28(x, dz);
+    g->z = z + mul_q28(x, dy) - mul_q28(y, dx);
+    renorm_q28(g);
+}
+
+void ICM426xx_GravityUpdateF(ICM426xx_GravityF *g, const ICM426xx_Sample *s, uint32_t dt_us)
+{
+    const float lo = (1.0f - ICM426xx_FUSION_GATE_G) * (1.0f - ICM426xx_FUSION_GATE_G);
+    const float hi = (1.0f + ICM426xx_FUSION_GATE_G) * (1.0f + ICM426xx_FUSION_GATE_G);
+    const float rad = 3.14159265f / 180.0f;
+    float a2   = s->ax * s->ax + s->ay * s->ay + s->az * s->az;
+    bool  rest = a2 > lo && a2 < hi;
+
+    if (!g->primed) {
+        g->bx = g->by = g->bz = 0.0f;
+        float n = rest ? 1.0f / sqrtf(a2) : 0.0f;
+        g->x = s->ax * n; g->y = s->ay * n; g->z = rest ? s->az * n : 1.0f;
+        g->primed = true;
+        return;
+    }
+
+    float ex = 0.0f, ey = 0.0f, ez = 0.0f;
+    if (rest) {
+        ex = s->ay * g->z - s->az * g->y;
+        ey = s->az * g->x - s->ax * g->z;
+        ez = s->ax * g->y - s->ay * g->x;
+    }
+
+    float dt = dt_us * 1e-6f;
+    g->bx += ICM426xx_FUSION_KI * ex * dt;
+    g->by += ICM426xx_FUSION_KI * ey * dt;
+    g->bz += ICM426xx_FUSION_KI * ez * dt;
+    float dx = (s->gx * rad + ICM426xx_FUSION_KP * ex + g->bx) * dt;
+    float dy = (s->gy * rad + ICM426xx_FUSION_KP * ey + g->by) * dt;
+    float dz = (s->gz * rad + ICM426xx_FUSION_KP * ez + g->bz) * dt;
+
+    float x = g->x, y = g->y, z = g->z;
+    g->x = x + y * dz - z * dy;
+    g->y = y + z * dx - x * dz;
+    g->z = z + x * dy - y * dx;
+    float f = (3.0f - (g->x * g->x + g->y * g->y + g->z * g->z)) * 0.5f;
+    g->x *= f; g->y *= f; g->z *= f;
+}
+
+// ---- APEX gestures ----
+uint8_t ICM426xx_interruptStatus3(void)
+{
+    // INT_STATUS3 (Bank 0, 0x38): step / tilt / wake / sleep / tap, clear on read
+    return read_single_ICM426xx_reg(B0_INT_STATUS3);
+}
+
+uint8_t ICM426xx_TapCount(void)
+{
+    // APEX_DATA4 (Bank 0, 0x35): TAP_NUM[4:3] TAP_AXIS[2:1] TAP_DIR[0]
+    return (read_single_ICM426xx_reg(B0_APEX_DATA4) >> 3) & 0x03;
+}
+
+void ICM426xx_ApexRoute(uint8_t events)
+{
+    // INT_SOURCE6 (Bank 4) enables use the INT_STATUS3 bit layout
+    events &= APEX_EVENTS_ALL;
+    if (events == apex_route) return;
+    write_bank_reg(4, B4_INT_SOURCE6, events);
+    apex_route = events;
+}
+
+#ifdef LED_BENCH
+/* CPU-busy cycles per sample draining the same size of batch both ways:
+   blocking = the whole ICM426xx_FifoRead; DMA = the queueing call, both
+   completion callbacks and the parse, but not the wait in between. */
+void ICM426xx_BenchFifo(uint32_t *block_cyc, uint32_t *dma_cyc)
+{
+    ICM426xx_Sample out[ICM426xx_FIFO_BATCH_MAX];
+    ICM426xx_Profile was = ICM426xx_GetProfile();
+    // a full batch at the bench profile's ODR, plus 20 ms for tick jitter
+    uint32_t fill_ms = ICM426xx_FIFO_WATERMARK * PROFILES[ICM426xx_PROFILE_LN_200].odr_ms + 20;
+
+    ICM426xx_SetProfile(ICM426xx_PROFILE_LN_200);          // both sensors in the packets
+    while (!ICM426xx_Settled()) { }                        // gyro start-up, up to 45 ms
+    ICM426xx_FifoEnable(ICM426xx_FIFO_WATERMARK);
+    HAL_Delay(fill_ms);
+    uint32_t t0 = Profile_Cycles();
+    uint16_t n = ICM426xx_FifoRead(out, ICM426xx_FIFO_BATCH_MAX);
+    *block_cyc = n ? (Profile_Cycles() - t0) / n : 0;
+
+    HAL_Delay(fill_ms);
+    cb_cycles = 0;
+    t0 = Profile_Cycles();
+    ICM426xx_FifoReadAsync();
+    uint32_t busy = Profile_Cycles() - t0;
+    while (!fifo_rx_ready) { }
+    t0 = Profile_Cycles();
+    n = ICM426xx_FifoCollect(out, ICM426xx_FIFO_BATCH_MAX);
+    busy += Profile_Cycles() - t0 + cb_cycles;
+    *dma_cyc = n ? busy / n : 0;
+
+    ICM426xx_FifoDisable();
+    ICM426xx_SetProfile(was);
+}
+
+/* Register block → sample, per sample over a batch of recorded blocks:
+   float = the old divide-by-sensitivity decode, raw = int16 plus FSR,
+   q16 = raw and then all six values through the Q16 helpers. */
+#define BENCH_CONVERT_N  64
+
+void ICM426xx_BenchConvert(uint32_t *float_cyc, uint32_t *raw_cyc, uint32_t *q16_cyc)
+{
+    static uint8_t regs[BENCH_CONVERT_N][12];
+    static volatile ICM426xx_Sample    fs;
+    static volatile ICM426xx_SampleRaw rs;
+    static volatile int32_t q;
+
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i)
+        for (uint8_t b = 0; b < 12; ++b) regs[i][b] = (uint8_t)(i * 37u + b * 11u);
+
+    uint32_t t0 = Profile_Cycles();
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i) {
+        const uint8_t *b = regs[i];
+        fs.ax = be16(b + 0)  / accel_lsb_per_g;
+        fs.ay = be16(b + 2)  / accel_lsb_per_g;
+        fs.az = be16(b + 4)  / accel_lsb_per_g;
+        fs.gx = be16(b + 6)  / gyro_lsb_per_dps;
+        fs.gy = be16(b + 8)  / gyro_lsb_per_dps;
+        fs.gz = be16(b + 10) / gyro_lsb_per_dps;
+    }
+    *float_cyc = (Profile_Cycles() - t0) / BENCH_CONVERT_N;
+
+    ICM426xx_SampleRaw r;
+    t0 = Profile_Cycles();
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i) {
+        raw_from_regs(regs[i], &r);
+        rs = r;
+    }
+    *raw_cyc = (Profile_Cycles() - t0) / BENCH_CONVERT_N;
+
+    t0 = Profile_Cycles();
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i) {
+        raw_from_regs(regs[i], &r);
+        q = ICM426xx_AccelQ16(r.ax, r.accel_fsr_g) + ICM426xx_AccelQ16(r.ay, r.accel_fsr_g) +
+            ICM426xx_AccelQ16(r.az, r.accel_fsr_g) + ICM426xx_GyroQ16(r.gx, r.gyro_fsr_dps) +
+            ICM426xx_GyroQ16(r.gy, r.gyro_fsr_dps) + ICM426xx_GyroQ16(r.gz, r.gyro_fsr_dps);
+    }
+    *q16_cyc = (Profile_Cycles() - t0) / BENCH_CONVERT_N;
+}
+
+// One 200 Hz sample tilted 30 degrees and turning, run through both filters
+void ICM426xx_BenchFusion(uint32_t *float_cyc, uint32_t *fixed_cyc)
+{
+    ICM426xx_SampleRaw r = { 8192, 0, 14189, 1310, -655, 262,
+                             ICM426xx_ACCEL_FSR_G, ICM426xx_GYRO_FSR_DPS, 0 };
+    ICM426xx_Sample    s;
+    ICM426xx_RawToSample(&r, &s);
+    static ICM426xx_GravityF gf;
+    static ICM426xx_Gravity  gq;
+    gf.primed = gq.primed = false;
+    ICM426xx_GravityUpdateF(&gf, &s, 5000);
+    ICM426xx_GravityUpdate(&gq, &r, 5000);
+
+    uint32_t t0 = Profile_Cycles();
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i) ICM426xx_GravityUpdateF(&gf, &s, 5000);
+    *float_cyc = (Profile_Cycles() - t0) / BENCH_CONVERT_N;
+
+    t0 = Profile_Cycles();
+    for (uint16_t i = 0; i < BENCH_CONVERT_N; ++i) ICM426xx_GravityUpdate(&gq, &r, 5000);
+    *fixed_cyc = (Profile_Cycles() - t0) / BENCH_CONVERT_N;
+}
+#endif
+
 // ---- Accessor ----
 ICM426xx_Sample ICM426xx_value(void)
 {
 	
     return sample;
 }
+
+ICM426xx_SampleRaw ICM426xx_valueRaw(void)
+{
+    return sample_raw;
+}
@@ -23,11 +23,133 @@
 typedef struct {
     float ax, ay, az;   // accel in g
     float gx, gy, gz;   // gyro in dps
-    uint32_t ts;        // timestamp (20-bit, in sample ticks)
+    uint32_t ts;        // FIFO: sensor µs at sampling; ICM426xx_loop: HAL tick (ms) at the read
 } ICM426xx_Sample;
 
 ICM426xx_Sample ICM426xx_value(void);
 void ICM426xx_loop(void);
+
+// ---- Raw samples: register LSBs plus the full scale they were taken at ----
+// For integer consumers; the float ICM426xx_Sample is converted from these.
+#define ICM426xx_ACCEL_FSR_G     2      // ±2 g
+#define ICM426xx_GYRO_FSR_DPS    250    // ±250 dps
+
+typedef struct {
+    int16_t  ax, ay, az;     // accel LSB, ±32768 = ±accel_fsr_g
+    int16_t  gx, gy, gz;     // gyro LSB, ±32768 = ±gyro_fsr_dps
+    uint8_t  accel_fsr_g;
+    uint16_t gyro_fsr_dps;
+    uint32_t ts;             // as ICM426xx_Sample.ts
+} ICM426xx_SampleRaw;
+
+ICM426xx_SampleRaw ICM426xx_valueRaw(void);
+void ICM426xx_RawToSample(const ICM426xx_SampleRaw *r, ICM426xx_Sample *s);   // multiplies, no division
+
+// Fixed point, exact up to the final shift: Q16 = 65536 per g / per dps
+static inline int32_t ICM426xx_AccelQ16(int16_t raw, uint8_t fsr_g)     { return (int32_t)raw * fsr_g * 2; }
+static inline int32_t ICM426xx_GyroQ16(int16_t raw, uint16_t fsr_dps)   { return (int32_t)raw * fsr_dps * 2; }
+static inline int32_t ICM426xx_AccelMg(int16_t raw, uint8_t fsr_g)      { return ((int32_t)raw * fsr_g * 1000) >> 15; }
+
+// ---- Gravity fusion (Mahony, gravity direction only) ----
+// Tracks the unit vector the accel would read at rest by integrating the
+// gyro, pulled toward the accel at ICM426xx_FUSION_KP while |a| is within
+// ICM426xx_FUSION_GATE_G of 1 g; jerks outside that only move it by gyro.
+// Needs a gyro-on profile (ICM426xx_PROFILE_LN_200); call once per sample.
+#define ICM426xx_FUSION_KP       1.0f    // 1/s: accel pull, ~1 s time constant
+#define ICM426xx_FUSION_KI       0.05f   // 1/s^2: gyro bias learning
+#define ICM426xx_FUSION_GATE_G   0.15f
+#define ICM426xx_GRAVITY_ONE     (1L << 28)   // ICM426xx_Gravity unit
+
+typedef struct {
+    int32_t x, y, z;         // Q28 unit vector, sensor axes
+    int32_t bx, by, bz;      // gyro bias correction, rad/s Q24
+    bool    primed;          // false: the next sample seeds it from the accel
+} ICM426xx_Gravity;
+
+typedef struct {
+    float x, y, z;
+    float bx, by, bz;
+    bool  primed;
+} ICM426xx_GravityF;
+
+void ICM426xx_GravityUpdate(ICM426xx_Gravity *g, const ICM426xx_SampleRaw *r, uint32_t dt_us);
+void ICM426xx_GravityUpdateF(ICM426xx_GravityF *g, const ICM426xx_Sample *s, uint32_t dt_us);  // float reference
+
+// ---- Non-blocking bring-up ----
+// ICM426xx_InitStart() resets the sensor; call ICM426xx_InitStep() from the
+// main loop until it returns true. ICM426xx_init() does the same, blocking.
+#define ICM426xx_ACCEL_STARTUP_MS   10   // off → valid data
+#define ICM426xx_GYRO_STARTUP_MS    45
+void ICM426xx_InitStart(void);
+bool ICM426xx_InitStep(void);       // true once motion data is valid
+bool ICM426xx_Ready(void);
+#ifdef LED_BENCH
+uint32_t ICM426xx_BenchReadyTick(void);   // HAL tick when it became ready
+#endif
+
+// ---- Power / ODR profiles (±2 g, ±250 dps throughout) ----
+// A switch returns after ~1 ms, but a sensor it turns on only gives valid
+// data after its start-up time. Until then ICM426xx_Settled() is false and
+// the FIFO readers hand out nothing; what the FIFO gathered meanwhile is
+// flushed once it is over.
+typedef enum {
+    ICM426xx_PROFILE_OFF = 0,        // accel and gyro off, registers kept
+    ICM426xx_PROFILE_APEX,           // accel low power 200 Hz (tap needs it), APEX gestures only
+    ICM426xx_PROFILE_ACCEL_LP_50,    // accel low power 50 Hz
+    ICM426xx_PROFILE_LN_200,         // accel + gyro low noise 200 Hz
+    ICM426xx_PROFILE_COUNT           // also what GetProfile reports before bring-up
+} ICM426xx_Profile;
+
+void ICM426xx_SetProfile(ICM426xx_Profile p);   // in place, ~1 ms; ready sensor only
+bool ICM426xx_Settled(void);                    // start-up of the last switch is over
+ICM426xx_Profile ICM426xx_GetProfile(void);
+uint32_t ICM426xx_ProfileCurrent_uA(ICM426xx_Profile p);   // typical sensor supply
+
+// ---- FIFO batching (watermark on INT1 / ACC_INT) ----
+#define ICM426xx_FIFO_PACKET_LEN   16   // packet 3: header, accel, gyro, temp, timestamp
+#define ICM426xx_FIFO_BATCH_MAX    32   // records per ICM426xx_FifoRead (512 B burst)
+#define ICM426xx_FIFO_WATERMARK    10   // records: one batch per 50 ms at 200 Hz (bench default)
+
+#define ICM426xx_INT_DATA_RDY      0x08 // INT_STATUS bits
+#define ICM426xx_INT_FIFO_THS      0x04
+#define ICM426xx_INT_FIFO_FULL     0x02
+
+void ICM426xx_FifoEnable(uint16_t watermark);   // flushes, then streams; records
+void ICM426xx_FifoDisable(void);
+uint16_t ICM426xx_FifoRead(ICM426xx_Sample *out, uint16_t max);    // drains one batch
+uint16_t ICM426xx_FifoParse(const uint8_t *buf, uint16_t len, ICM426xx_Sample *out, uint16_t max);
+uint16_t ICM426xx_FifoParseRaw(const uint8_t *buf, uint16_t len, ICM426xx_SampleRaw *out, uint16_t max);
+
+// ---- APEX gestures (tilt, raise-to-wake, tap) on INT1 ----
+// Run on the sensor from the accel samples; the MCU only sees the event.
+// INT_STATUS3 flags, also the ICM426xx_ApexRoute mask.
+#define ICM426xx_APEX_TILT         0x08 // held tilted for 2 s
+#define ICM426xx_APEX_WAKE         0x04 // wrist raised to look at the watch
+#define ICM426xx_APEX_SLEEP        0x02 // wrist lowered again
+#define ICM426xx_APEX_TAP          0x01 // single or double tap: see ICM426xx_TapCount
+
+void ICM426xx_ApexRoute(uint8_t events);   // which events pulse INT1; all after init
+uint8_t ICM426xx_interruptStatus3(void);   // clear on read
+uint8_t ICM426xx_TapCount(void);           // 1 or 2 for the last tap event
+
+// ---- Asynchronous reads (SPI1 DMA) ----
+// done() runs in the DMA interrupt with CS already released; rx is NULL on
+// an SPI error and stays valid until the next transfer is queued.
+#define ICM426xx_XFER_MAX   (ICM426xx_FIFO_BATCH_MAX * ICM426xx_FIFO_PACKET_LEN)
+typedef void (*ICM426xx_XferDone)(const uint8_t *rx, uint16_t len);
+
+bool ICM426xx_ReadAsync(uint8_t reg, uint16_t len, ICM426xx_XferDone done); // false if busy
+bool ICM426xx_XferBusy(void);
+void ICM426xx_SpiComplete(SPI_HandleTypeDef *hspi, bool ok);   // from HAL_SPI_TxRxCpltCallback
+bool ICM426xx_FifoReadAsync(void);                              // count, then the batch; false if busy or uncollected
+uint16_t ICM426xx_FifoCollect(ICM426xx_Sample *out, uint16_t max); // 0 until it lands
+uint16_t ICM426xx_FifoCollectRaw(ICM426xx_SampleRaw *out, uint16_t max);  // same, no float
+
+#ifdef LED_BENCH
+void ICM426xx_BenchFifo(uint32_t *block_cyc, uint32_t *dma_cyc); // CPU cycles per sample
+void ICM426xx_BenchConvert(uint32_t *float_cyc, uint32_t *raw_cyc, uint32_t *q16_cyc); // per 12-byte sample
+void ICM426xx_BenchFusion(uint32_t *float_cyc, uint32_t *fixed_cyc);   // per gravity update
+#endif
 // ---- Scaling factors (depends on FSR) ----
 static const  float accel_lsb_per_g = 16384.0f; // for ±2g
 static const  float gyro_lsb_per_dps = 131.0f;  // for ±250 dps
@@ -0,0 +1,92 @@
+# Rough supply-current model: normal clock (TIM2 scan, 16 MHz) vs the ambient
+# display (LPTIM1 scan, 4 MHz). Host-only: python power_model.py
+# Geometry, glyphs and ambient timing are read from src/; the MCU and LED
+# figures below are typical datasheet / bench guesses, so treat the output
+# as a ratio more than as absolute milliamps.
+import os
+import re
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+
+# ---- assumptions (STM32L432 typ. @ 3 V, 25 C, from flash) ----
+RUN_UA_PER_MHZ   = {1: 100.0, 2: 85.0}    # Run, by regulator range
+SLEEP_UA_PER_MHZ = {1: 30.0,  2: 26.0}    # Sleep, by regulator range
+LSE_LPTIM_UA     = 1.0
+I_LED_MA         = 5.0                    # one LED through two pin drivers
+MASTER           = 32                     # Led_SetGlobalBrightness() in main.c
+TIM_ISR_CYC      = (120, 80)              # HAL dispatch + body: slot start, slot end
+LPTIM_ISR_CYC    = (150, 110)             # HAL_LPTIM_IRQHandler checks more flags
+LSE_HZ           = 32768.0
+
+
+def read(rel):
+    return open(os.path.join(ROOT, rel)).read()
+
+
+def define(text, name):
+    return int(re.search(r"#define\s+" + name + r"\s+(\d+)", text).group(1))
+
+
+def glyph_bits():
+    body = re.search(r"HEX_3x5\[16\]\[HEX_H\]\s*=\s*\{(.*?)\};", read("src/led_driver.h"), re.S).group(1)
+    rows = [int(b, 2) for b in re.findall(r"0b([01]+)", body)]
+    return [sum(bin(r).count("1") for r in rows[d * 5:d * 5 + 5]) for d in range(10)]
+
+
+def mean_lit(bits, seconds):
+    # average lit pixels over a 12 h day, as Led_DrawClock / Led_AmbientUpdate draw it
+    total = n = 0
+    for hh in range(12):
+        h = hh or 12
+        hhmm = (bits[h // 10] if h >= 10 else 0) + bits[h % 10]
+        for mm in range(60):
+            base = hhmm + bits[mm // 10] + bits[mm % 10]
+            if not seconds:
+                total += base + 2
+                n += 1
+                continue
+            for ss in range(60):
+                total += base + (2 if ss % 2 == 0 else 0) + bits[ss // 10] + bits[ss % 10]
+                n += 1
+    return total / n
+
+
+def core_ua(mhz, vrange, busy):
+    return busy * RUN_UA_PER_MHZ[vrange] * mhz + (1 - busy) * SLEEP_UA_PER_MHZ[vrange] * mhz
+
+
+def main():
+    hdr  = read("src/led_driver.h")
+    arr  = int(re.search(r"htim2\.Init\.Period\s*=\s*(\d+)", read("src/tim.c")).group(1)) + 1
+    bits = glyph_bits()
+
+    # normal: every slot lit, ON = gamma(255)*ARR/2*master/255 plus end-ISR latency
+    slot_hz  = 16e6 / arr
+    lit      = mean_lit(bits, True)
+    on_cyc   = (arr // 2) * MASTER / 255.0 + TIM_ISR_CYC[1]
+    busy     = slot_hz * sum(TIM_ISR_CYC) / 16e6
+    n_core   = core_ua(16, 1, busy)
+    n_led    = on_cyc / arr * I_LED_MA * 1000
+    n_bright = on_cyc / 16e6 * slot_hz / lit
+
+    # ambient: LSE slots, fixed frame, padding slots dark
+    slot_t   = define(hdr, "AMBIENT_SLOT_TICKS")
+    on_t     = define(hdr, "AMBIENT_ON_TICKS")
+    frame    = define(hdr, "AMBIENT_FRAME_SLOTS")
+    a_hz     = LSE_HZ / slot_t
+    a_lit    = mean_lit(bits, False)
+    a_busy   = a_hz * sum(LPTIM_ISR_CYC) / 4e6
+    a_core   = core_ua(4, 2, a_busy) + LSE_LPTIM_UA
+    a_led    = on_t / slot_t * min(a_lit, frame) / max(a_lit, frame) * I_LED_MA * 1000
+    a_bright = on_t / LSE_HZ * a_hz / max(a_lit, frame)
+
+    print("normal : %5.0f slots/s, %4.1f px, fps %3.0f, core %4.0f uA, LED %4.0f uA, total %4.0f uA"
+          % (slot_hz, lit, slot_hz / lit, n_core, n_led, n_core + n_led))
+    print("ambient: %5.0f slots/s, %4.1f px, fps %3.0f, core %4.0f uA, LED %4.0f uA, total %4.0f uA"
+          % (a_hz, a_lit, a_hz / max(a_lit, frame), a_core, a_led, a_core + a_led))
+    print("ambient draws %.0f%% of normal at %.0f%% of the per-pixel brightness"
+          % (100 * (a_core + a_led) / (n_core + n_led), 100 * a_bright / n_bright))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,54 @@
+Import("env")
+import os
+import re
+
+# Emit a linker map and, after linking, list what the RAMFUNC / RAMDATA
+# attributes (see main.h) actually placed in SRAM.
+map_path = os.path.join(env.subst("$BUILD_DIR"), "firmware.map")
+
+env.Append(LINKFLAGS=["-Wl,-Map=" + map_path])
+
+SECTION_RE = re.compile(r"^ (\.RamFunc\S*|\.data\.ram\.\S*)(?:\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+))?$")
+CONT_RE    = re.compile(r"^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+)$")
+SYMBOL_RE  = re.compile(r"^\s+0x([0-9a-f]+)\s+([A-Za-z_]\w*)$")
+
+def ram_report(source, target, env):
+    if not os.path.exists(map_path):
+        print("ram_report: no map file at %s" % map_path)
+        return
+
+    entries = []
+    pending = None
+    with open(map_path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            m = SECTION_RE.match(line)
+            if m:
+                if m.group(2):
+                    entries.append([m.group(1), int(m.group(2), 16), int(m.group(3), 16),
+                                    os.path.basename(m.group(4)), []])
+                    pending = None
+                else:
+                    pending = m.group(1)    # long name, address on next line
+                continue
+            if pending:
+                m = CONT_RE.match(line)
+                if m:
+                    entries.append([pending, int(m.group(1), 16), int(m.group(2), 16),
+                                    os.path.basename(m.group(3)), []])
+                pending = None
+                continue
+            if entries:
+                m = SYMBOL_RE.match(line)
+                if m and int(m.group(1), 16) < entries[-1][1] + entries[-1][2]:
+                    entries[-1][4].append(m.group(2))
+
+    code = sum(e[2] for e in entries if e[0].startswith(".RamFunc"))
+    data = sum(e[2] for e in entries if e[0].startswith(".data.ram."))
+    print("SRAM placement (%d B code, %d B tables):" % (code, data))
+    for name, addr, size, obj, syms in entries:
+        if size == 0:
+            continue
+        print("  0x%08x %5d  %-22s %-16s %s" % (addr, size, name, obj, " ".join(syms)))
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", ram_report)
@@ -0,0 +1,129 @@
+#include "anim.h"
+#include "profile.h"
+
+// easeInExpo, 2^(10(t-1)) sampled at t = i/64, Q16. easeOutExpo is the
+// mirror image, 1 - in(1 - t), so one table serves both.
+static const uint16_t EXPO_IN_Q16[65] = {
+      0,    71,    79,    89,    99,   110,   123,   137,
+    152,   170,   189,   211,   235,   262,   292,   325,
+    362,   403,   450,   501,   558,   622,   693,   773,
+    861,   960,  1069,  1192,  1328,  1480,  1649,  1838,
+   2048,  2282,  2543,  2834,  3158,  3520,  3922,  4371,
+   4871,  5428,  6049,  6741,  7512,  8371,  9329, 10396,
+  11585, 12910, 14387, 16033, 17867, 19910, 22188, 24726,
+  27554, 30706, 34218, 38132, 42494, 47355, 52772, 58808,
+  65535,
+};
+
+typedef struct {
+    const Anim_Track *track;     // NULL = free slot
+    uint32_t start_ms;
+    uint16_t duration_ms;
+    int16_t  last;               // last value handed to apply()
+    bool     first;              // apply() not called yet
+} Anim_Slot;
+
+static Anim_Slot slots[ANIM_MAX_TRACKS];
+static uint32_t  last_frame_ms;
+
+#ifdef LED_BENCH
+static uint32_t busy_cycles;
+#endif
+
+static uint16_t expo_in(uint16_t t)
+{
+    uint32_t i   = t >> 10;                 // 64 segments
+    uint32_t f   = t & 0x3FFu;
+    uint32_t a   = EXPO_IN_Q16[i];
+    uint32_t b   = EXPO_IN_Q16[i + (i < 64)];
+    return (uint16_t)(a + (((b - a) * f) >> 10));
+}
+
+uint16_t Anim_Ease16(Anim_Ease ease, uint16_t t)
+{
+    switch (ease) {
+        case ANIM_EASE_IN_EXPO:  return expo_in(t);
+        case ANIM_EASE_OUT_EXPO: return (uint16_t)(65535u - expo_in((uint16_t)(65535u - t)));
+        case ANIM_EASE_LINEAR:
+        default:                 return t;
+    }
+}
+
+bool Anim_Start(const Anim_Track *track, uint16_t duration_ms)
+{
+    Anim_Slot *free_slot = NULL;
+    for (int i = 0; i < ANIM_MAX_TRACKS; ++i) {
+        if (slots[i].track == track) { free_slot = &slots[i]; break; }  // restart
+        if (!slots[i].track && !free_slot) free_slot = &slots[i];
+    }
+    if (!free_slot) return false;
+
+    free_slot->track       = track;
+    free_slot->start_ms    = HAL_GetTick();
+    free_slot->duration_ms = duration_ms ? duration_ms : 1;
+    free_slot->first       = true;
+    last_frame_ms = free_slot->start_ms - ANIM_FRAME_MS;   // draw frame 0 right away
+    return true;
+}
+
+void Anim_Stop(const Anim_Track *track)
+{
+    for (int i = 0; i < ANIM_MAX_TRACKS; ++i)
+        if (slots[i].track == track) slots[i].track = NULL;
+}
+
+bool Anim_Busy(void)
+{
+    for (int i = 0; i < ANIM_MAX_TRACKS; ++i)
+        if (slots[i].track) return true;
+    return false;
+}
+
+bool Anim_Tick(uint32_t now_ms)
+{
+    if (!Anim_Busy()) return false;
+    if ((now_ms - last_frame_ms) < ANIM_FRAME_MS) return false;
+    last_frame_ms = now_ms;
+
+#ifdef LED_BENCH
+    uint32_t t0 = Profile_Cycles();
+#endif
+
+    for (int i = 0; i < ANIM_MAX_TRACKS; ++i) {
+        Anim_Slot *s = &slots[i];
+        const Anim_Track *tr = s->track;
+        if (!tr) continue;
+
+        uint32_t elapsed = now_ms - s->start_ms;
+        bool finished = (elapsed >= s->duration_ms);
+        uint16_t t = finished ? 65535u
+                              : (uint16_t)((elapsed * 65535u) / s->duration_ms);
+
+        int32_t span  = (int32_t)tr->to - tr->from;
+        int32_t value = tr->from + ((span * (int32_t)Anim_Ease16(tr->ease, t)) / 65535);
+
+        // Only redraw when the quantised value moves
+        if (s->first || value != s->last) {
+            s->first = false;
+            s->last  = (int16_t)value;
+            tr->apply((int16_t)value);
+        }
+
+        if (finished) {
+            s->track = NULL;               // free first: done() may start another track
+            if (tr->done) tr->done();
+        }
+    }
+
+#ifdef LED_BENCH
+    busy_cycles += Profile_Cycles() - t0;
+#endif
+    return true;
+}
+
+#ifdef LED_BENCH
+uint32_t Anim_BenchBusyCycles(void)
+{
+    return busy_cycles;
+}
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+#include "main.h"
+#include <stdbool.h>
+
+// Non-blocking tween engine. A transition is a const Anim_Track (easing,
+// value range, callbacks); Anim_Tick() advances every running track from
+// the main loop and only calls apply() when the eased value changes.
+
+#define ANIM_FRAME_MS   20      // frame tick, same cadence as the old curtains
+#define ANIM_MAX_TRACKS 4
+
+typedef enum {
+    ANIM_EASE_LINEAR = 0,
+    ANIM_EASE_IN_EXPO,
+    ANIM_EASE_OUT_EXPO,
+} Anim_Ease;
+
+typedef struct {
+    Anim_Ease ease;
+    int16_t   from, to;                 // value range handed to apply()
+    void    (*apply)(int16_t value);    // draw one frame for this value
+    void    (*done)(void);              // optional, runs once after the last frame
+} Anim_Track;
+
+bool Anim_Start(const Anim_Track *track, uint16_t duration_ms);  // false if no free slot
+void Anim_Stop(const Anim_Track *track);                         // drop without done()
+bool Anim_Tick(uint32_t now_ms);                                 // true if a frame ran
+bool Anim_Busy(void);
+uint16_t Anim_Ease16(Anim_Ease ease, uint16_t t);                // t, result: 0..65535
+
+#ifdef LED_BENCH
+uint32_t Anim_BenchBusyCycles(void);   // CYCCNT spent inside Anim_Tick frames
+#endif
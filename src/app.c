@@ -4,23 +4,68 @@
 #include "ICM426xx.h"
 #include "fluid.h"
 #include "time.h"
+#include "anim.h"
+#include "tim.h"
 
 volatile uint32_t last_motion_ms = 0;
 volatile uint32_t last_tick = 0;
 volatile AppState g_appState = APP_STATE_DEBUG;  // default
 uint8_t status = 0x00;
-static uint32_t last_physics = 0;
+static uint32_t last_physics = 0;   // sensor µs of the last fluid step
+static uint32_t last_sample;        // sensor µs of the last fused sample
+static ICM426xx_Gravity gravity;    // fused gravity the fluid falls along
+static bool sleep_pending = false;
+static uint8_t debug_page = 0;
+static uint8_t awake_master;        // brightness to fade back to after STOP2
+static volatile bool imu_int_pending;     // ACC_INT edge, status not read yet
+static bool imu_stream_on;                // FIFO sample stream running
+static bool imu_stream_want;
+static ICM426xx_Profile imu_profile_want = ICM426xx_PROFILE_APEX;
+
+// Sensor power per state: every state keeps the accel at the tap detector's
+// 200 Hz so a tap can always leave it; the fluid adds the gyro for fusion
+static const ICM426xx_Profile STATE_PROFILE[] = {
+    [APP_STATE_CLOCK]      = ICM426xx_PROFILE_APEX,
+    [APP_STATE_ANALOG]     = ICM426xx_PROFILE_APEX,
+    [APP_STATE_DEBUG]      = ICM426xx_PROFILE_APEX,
+    [APP_STATE_EXPERIMENT] = ICM426xx_PROFILE_LN_200,
+};
+#define APP_STATE_COUNT  (APP_STATE_EXPERIMENT + 1)
+static bool physics_primed;               // last_physics holds a real sample
+
+// Sensor dt: gravity fuses every 200 Hz sample, the fluid steps once per
+// 20 ms of them; both capped so a stall does not fling the particles
+#define PHYSICS_DT_FIRST_US  20000u
+#define PHYSICS_DT_MIN_US    20000u
+#define PHYSICS_DT_MAX_US    100000u
+
+// Samples come through the FIFO so each carries the sensor's own timestamp;
+// INT1 fires once per fluid step's worth of them
+#define IMU_STREAM_WATERMARK 4u
+#define IMU_STREAM_BATCH     ICM426xx_FIFO_BATCH_MAX
+
+// Clock mode drops to the ambient display after this long without motion
+#define AMBIENT_AFTER_MS  10000u
+
+// Gestures that wake STOP2: a lowered wrist must not end it, and a tap
+// only switches modes while awake
+#define IMU_WAKE_EVENTS   (ICM426xx_APEX_WAKE | ICM426xx_APEX_TILT)
+#define IMU_AWAKE_EVENTS  (IMU_WAKE_EVENTS | ICM426xx_APEX_SLEEP | ICM426xx_APEX_TAP)
+
+static void app_enter_stop(void);
+static void app_imu_sync(void);
+static void app_imu_event(uint8_t st, uint8_t ev, uint32_t now);
 
 void App_Init(void) {
     Time_Init();
-    uint8_t hh, mm, ss;
-    Time_Get(&hh, &mm, &ss);
-    Led_CurtainReveal(300, hh, mm, ss);
-
     last_motion_ms = HAL_GetTick();
     last_tick = HAL_GetTick();
     App_SetState(g_appState);  // start in clock mode
 
+    uint8_t hh, mm, ss;
+    Time_Get(&hh, &mm, &ss);
+    Led_CurtainReveal(300, hh, mm, ss);   // runs from App_Loop
+
     fluid_init();  // 40 particles for example
 }
 
@@ -28,58 +73,139 @@ void App_Loop(void) {
     uint32_t now = HAL_GetTick();
     uint32_t wakeTime = 2000;
 
+    Anim_Tick(now);
+    Led_FadePoll();
+
     switch (g_appState) {
         case APP_STATE_CLOCK:
         case APP_STATE_ANALOG:
             wakeTime = 2000;
-            if ((now - last_tick) >= 1000) {
+            if (Led_AmbientActive()) {
+                if ((now - last_motion_ms) < AMBIENT_AFTER_MS) {
+                    App_LeaveAmbient();
+                } else if ((now - last_tick) >= 1000) {
+                    last_tick = now;
+                    uint8_t hh, mm, ss;
+                    Time_Get(&hh, &mm, &ss);
+                    Led_AmbientUpdate(hh, mm);      // no-op unless the minute changed
+                }
+                break;
+            }
+            if (g_appState == APP_STATE_CLOCK && !Anim_Busy() && !sleep_pending &&
+                (now - last_motion_ms) >= AMBIENT_AFTER_MS) {
+                App_EnterAmbient();
+                break;
+            }
+            if (!Anim_Busy() && (now - last_tick) >= 1000) {
                 last_tick = now;
                 uint8_t hh, mm, ss;
                 Time_Get(&hh, &mm, &ss);
                 if (g_appState == APP_STATE_CLOCK) {
                     Led_DrawClock(hh, mm, ss);
+                } else {
+                    Led_DrawAnalog(hh, mm, ss);
                 }
             }
             break;
 
         case APP_STATE_DEBUG:
+            wakeTime = 100000;
+            // Scan timing: one page on the matrix and one line on SWO per second
+            if (!Anim_Busy() && (now - last_tick) >= 1000) {
+                last_tick = now;
+                Led_ScanStats st;
+                Led_ScanStatsRead(&st);
+                Led_ScanStatsDump(&st);
+                Led_DrawScanStats(&st, debug_page, 255);
+                debug_page = (uint8_t)((debug_page + 1) % LED_STATS_PAGES);
+            }
+            break;
+
         case APP_STATE_EXPERIMENT:
             wakeTime = 100000;
             // Led_AllOn(50);
             break;
     }
 
+    // IMU bring-up runs alongside the display; nothing below touches the
+    // sensor until it reports ready
+    if (!ICM426xx_Ready()) {
+        if (ICM426xx_InitStep()) app_imu_sync();
+    }
+
+    // Physics runs by the sensor's own clock on the fused gravity, so a
+    // jerk of the hand does not slosh the fluid. s.ts is the FIFO packet
+    // timestamp, when the sample was taken, not when it reached us.
+    static ICM426xx_SampleRaw batch[IMU_STREAM_BATCH];
+    uint16_t n = ICM426xx_FifoCollectRaw(batch, IMU_STREAM_BATCH);
+    for (uint16_t i = 0; i < n && g_appState == APP_STATE_EXPERIMENT; ++i) {
+        const ICM426xx_SampleRaw *s = &batch[i];
+        if (!physics_primed) {
+            gravity.primed = false;
+            last_sample    = s->ts;
+            last_physics   = s->ts - PHYSICS_DT_FIRST_US;
+            physics_primed = true;
+        }
+        uint32_t fuse_us = s->ts - last_sample;
+        last_sample = s->ts;
+        ICM426xx_GravityUpdate(&gravity, s, fuse_us < PHYSICS_DT_MAX_US ? fuse_us : PHYSICS_DT_MAX_US);
+
+        uint32_t dt_us = s->ts - last_physics;
+        if (dt_us >= PHYSICS_DT_MIN_US) {
+            if (dt_us > PHYSICS_DT_MAX_US) dt_us = PHYSICS_DT_MAX_US;
+            last_physics = s->ts;
+            fluid_update(gravity.x * (1.0f / ICM426xx_GRAVITY_ONE),
+                         gravity.y * (1.0f / ICM426xx_GRAVITY_ONE), dt_us);
+        }
+    }
+
+    // Sensor interrupt: INT1 carries both the FIFO watermark and the APEX
+    // gestures. Status is read here, not in the EXTI callback, so it never
+    // collides with a DMA transfer in flight.
+    if (imu_int_pending && ICM426xx_Ready() && !ICM426xx_XferBusy()) {
+        imu_int_pending = false;
+        uint8_t st = ICM426xx_interruptStatus();
+        app_imu_event(st, ICM426xx_interruptStatus3(), now);
+    }
+
     // Sleep check
     // static uint32_t last_wake_ms = 0;
     // if ((now - last_motion_ms) > wakeTime) {
     //     App_GoToSleep();
     //     last_wake_ms = HAL_GetTick();   // remember when we last woke up
     // }
+
+    // Nothing left until the next SysTick / TIM2 / EXTI interrupt
+    __WFI();
 }
 
 void App_GoToSleep(void)
 {
-    uint8_t hh, mm, ss;
+    if (sleep_pending) return;          // fade-out already running
+    App_LeaveAmbient();                 // the fade is stepped by the TIM2 scan
+    sleep_pending = true;
 
-    // Clear any stale interrupts before sleep
-    ICM426xx_interruptStatus();
+    // STOP2 ends on a wrist gesture only: APEX profile, no sample stream,
+    // stale interrupts cleared
+    if (ICM426xx_Ready()) {
+        ICM426xx_SetProfile(ICM426xx_PROFILE_APEX);
+        ICM426xx_ApexRoute(IMU_WAKE_EVENTS);
+        if (imu_stream_on) ICM426xx_FifoDisable();
+        imu_stream_on = false;
+        ICM426xx_interruptStatus();
+        ICM426xx_interruptStatus3();
+    }
     __HAL_GPIO_EXTI_CLEAR_IT(ACC_INT_Pin);
     __HAL_PWR_CLEAR_FLAG(PWR_FLAG_WU);
 
-    // Animate closing curtains
-    switch (g_appState) {
-        case APP_STATE_CLOCK:
-            Time_Get(&hh, &mm, &ss);
-            Led_CurtainClose(300, hh, mm, ss);
-            break;
-        case APP_STATE_ANALOG:
-            // TODO: analog-specific c lose
-            break;
-        case APP_STATE_DEBUG:
-        case APP_STATE_EXPERIMENT:
-            // TODO: debug/experiment close
-            break;
-    }
+    // Fade out in the scan ISR; STOP2 is entered from the completion hook
+    awake_master = Led_GetGlobalBrightness();
+    Led_FadeTo(0, 300, ANIM_EASE_OUT_EXPO, app_enter_stop);
+}
+
+static void app_enter_stop(void)
+{
+    uint8_t hh, mm, ss;
 
     Display_Clear();
     HAL_Delay(10);
@@ -95,32 +221,98 @@ void App_GoToSleep(void)
     HAL_ResumeTick();
     SystemClock_Config();   // re-init clocks
     last_motion_ms = HAL_GetTick();
+    sleep_pending = false;
+    app_imu_sync();         // back to the state's sensor profile
 
     Display_Clear();
 
-    // Animate opening curtains
-    switch (g_appState) {
-        case APP_STATE_CLOCK:
-            Time_Get(&hh, &mm, &ss);
-            Led_CurtainReveal(300, hh, mm, ss);
-            break;
-        case APP_STATE_ANALOG:
-            // TODO: analog-specific open
-            break;
-        case APP_STATE_DEBUG:
-        case APP_STATE_EXPERIMENT:
-            // TODO: debug/experiment open
-            break;
+    // Draw at master 0, then fade back in
+    if (g_appState == APP_STATE_CLOCK || g_appState == APP_STATE_ANALOG) {
+        Time_Get(&hh, &mm, &ss);
+        if (g_appState == APP_STATE_CLOCK) Led_DrawClock(hh, mm, ss);
+        else                               Led_DrawAnalog(hh, mm, ss);
+        last_tick = HAL_GetTick();
     }
+    Led_FadeTo(awake_master, 300, ANIM_EASE_IN_EXPO, NULL);
+}
+
+
+
+/* Ambient display: HH:MM on LPTIM1 with the core at 4 MHz. TIM6/TIM7 are
+   PCLK-timed and idle in this build, so they are simply stopped. */
+void App_EnterAmbient(void)
+{
+    uint8_t hh, mm, ss;
+
+    if (Led_AmbientActive()) return;
+    HAL_TIM_Base_Stop_IT(&htim6);
+    HAL_TIM_Base_Stop_IT(&htim7);
+
+    Time_Get(&hh, &mm, &ss);
+    Led_AmbientEnter(hh, mm);       // TIM2 must stop before the clock drops
+    SystemClock_ConfigAmbient();
 }
 
+void App_LeaveAmbient(void)
+{
+    uint8_t hh, mm, ss;
 
+    if (!Led_AmbientActive()) return;
+    SystemClock_Config();           // back to 16 MHz before TIM2 restarts
+    Led_AmbientLeave();
+    HAL_TIM_Base_Start_IT(&htim6);
+    HAL_TIM_Base_Start_IT(&htim7);
+
+    Time_Get(&hh, &mm, &ss);
+    Led_DrawClock(hh, mm, ss);
+    last_tick = HAL_GetTick();
+}
 
 void App_SetState(AppState newState) {
+    App_LeaveAmbient();
+
+    // Only the physics playground consumes motion samples
+    imu_profile_want = STATE_PROFILE[newState];
+    imu_stream_want  = (newState == APP_STATE_EXPERIMENT);
+    app_imu_sync();
     g_appState = newState;
     Display_Clear(); // optional: clear screen when switching modes
 }
 
+// Applies the sensor setup the current state wants, once the IMU is up
+static void app_imu_sync(void)
+{
+    if (!ICM426xx_Ready()) return;
+    ICM426xx_SetProfile(imu_profile_want);      // no-op when unchanged
+    ICM426xx_ApexRoute(IMU_AWAKE_EVENTS);
+
+    if (imu_stream_want == imu_stream_on) return;
+    if (imu_stream_want) ICM426xx_FifoEnable(IMU_STREAM_WATERMARK);
+    else                 ICM426xx_FifoDisable();
+    imu_stream_on  = imu_stream_want;
+    physics_primed = false;
+}
+
+// One INT1 pulse, decoded: st = INT_STATUS, ev = INT_STATUS3
+static void app_imu_event(uint8_t st, uint8_t ev, uint32_t now)
+{
+    if (ev & IMU_WAKE_EVENTS) {
+        last_motion_ms = now;           // someone is looking
+    } else if ((ev & ICM426xx_APEX_SLEEP) && g_appState == APP_STATE_CLOCK) {
+        last_motion_ms = now - AMBIENT_AFTER_MS;   // wrist down: ambient right away
+    }
+
+    // Tap: one steps to the next mode, two step back
+    if (ev & ICM426xx_APEX_TAP) {
+        uint8_t step = (ICM426xx_TapCount() == 2) ? APP_STATE_COUNT - 1 : 1;
+        last_motion_ms = now;
+        App_SetState((AppState)((g_appState + step) % APP_STATE_COUNT));
+    }
+
+    if (imu_stream_on && (st & (ICM426xx_INT_FIFO_THS | ICM426xx_INT_FIFO_FULL)))
+        ICM426xx_FifoReadAsync();       // data lands while we draw or sleep
+}
+
 void App_SetLastTick(void) {
     last_tick = HAL_GetTick();
 }
@@ -129,7 +321,6 @@ void App_SetLastTick(void) {
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
     if (GPIO_Pin == ACC_INT_Pin) {
-        ICM426xx_interruptStatus();
-        last_motion_ms = HAL_GetTick();
+        imu_int_pending = true;         // App_Loop reads the status registers
     }
 }
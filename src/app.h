@@ -13,4 +13,8 @@ extern volatile AppState g_appState;
 
 void App_Init(void);
 void App_Loop(void);
-void App_GoToSleep(void);
\ No newline at end of file
+void App_GoToSleep(void);    // closes the curtain, then enters STOP2
+void App_SetState(AppState newState);
+void App_SetLastTick(void);
+void App_EnterAmbient(void);  // dim HH:MM on LPTIM1 at 4 MHz
+void App_LeaveAmbient(void);  // back to the full-rate clock
\ No newline at end of file
@@ -0,0 +1,222 @@
+// Generated by gen_led_tables.py from boards/round15.json - do not edit.
+#pragma once
+#include "led_tables.h"
+
+#define FACE_POS         60
+#define FACE_HANDS       3   // hour, minute, second
+#define FACE_HOUR        0
+#define FACE_MINUTE      1
+#define FACE_SECOND      2
+#define FACE_MARKS_N     12
+#define FACE_MARK_LEVEL  40
+
+typedef struct { uint8_t idx; uint8_t level; } FacePx;
+
+// hand h at position p covers FACE_PX[FACE_OFS[h*FACE_POS + p] .. FACE_OFS[h*FACE_POS + p + 1])
+static const uint16_t FACE_OFS[FACE_HANDS * FACE_POS + 1] = {
+  0, 19, 37, 54, 72, 89, 108, 127, 146, 165, 184, 203,
+  220, 238, 255, 273, 292, 310, 327, 345, 362, 381, 400, 419,
+  438, 457, 476, 493, 511, 528, 546, 565, 583, 600, 618, 635,
+  654, 673, 692, 711, 730, 749, 766, 784, 801, 819, 838, 856,
+  873, 891, 908, 927, 946, 965, 984, 1003, 1022, 1039, 1057, 1074,
+  1092, 1100, 1116, 1133, 1148, 1165, 1183, 1200, 1217, 1234, 1251, 1269,
+  1286, 1301, 1318, 1334, 1342, 1358, 1375, 1390, 1407, 1425, 1442, 1459,
+  1476, 1493, 1511, 1528, 1543, 1560, 1576, 1584, 1600, 1617, 1632, 1649,
+  1667, 1684, 1701, 1718, 1735, 1753, 1770, 1785, 1802, 1818, 1826, 1842,
+  1859, 1874, 1891, 1909, 1926, 1943, 1960, 1977, 1995, 2012, 2027, 2044,
+  2060, 2068, 2081, 2094, 2106, 2119, 2133, 2147, 2161, 2175, 2189, 2203,
+  2216, 2228, 2241, 2254, 2262, 2275, 2288, 2300, 2313, 2327, 2341, 2355,
+  2369, 2383, 2397, 2410, 2422, 2435, 2448, 2456, 2469, 2482, 2494, 2507,
+  2521, 2535, 2549, 2563, 2577, 2591, 2604, 2616, 2629, 2642, 2650, 2663,
+  2676, 2688, 2701, 2715, 2729, 2743, 2757, 2771, 2785, 2798, 2810, 2823,
+  2836,
+};
+
+static const FacePx FACE_PX[2836] = {
+  // hour: 0.55 R, 1.6 px wide, peak 255
+  /*  0 */ {37,109}, {51,144}, {52,255}, {53,144}, {66,155}, {67,255}, {68,155}, {81,155}, {82,255}, {83,155}, {96,155}, {97,255}, {98,155}, {111,152}, {112,255}, {113,152}, {126,58}, {127,148}, {128,58},
+  /*  1 */ {37,85}, {38,74}, {52,238}, {53,216}, {67,255}, {68,216}, {81,109}, {82,255}, {83,199}, {96,144}, {97,255}, {98,185}, {111,152}, {112,255}, {113,162}, {126,58}, {127,148}, {128,58},
+  /*  2 */ {38,58}, {52,185}, {53,251}, {54,95}, {67,223}, {68,251}, {82,245}, {83,228}, {96,116}, {97,255}, {98,203}, {111,152}, {112,255}, {113,165}, {126,58}, {127,148}, {128,58},
+  /*  3 */ {52,85}, {53,243}, {54,174}, {67,177}, {68,255}, {69,168}, {82,223}, {83,251}, {84,74}, {96,85}, {97,252}, {98,219}, {111,152}, {112,255}, {113,174}, {126,58}, {127,148}, {128,58},
+  /*  4 */ {53,192}, {54,208}, {67,103}, {68,252}, {69,225}, {82,197}, {83,255}, {84,159}, {96,74}, {97,246}, {98,237}, {111,148}, {112,255}, {113,180}, {126,58}, {127,148}, {128,58},
+  /*  5 */ {53,121}, {54,210}, {55,95}, {68,225}, {69,254}, {70,121}, {82,159}, {83,255}, {84,210}, {96,58}, {97,238}, {98,249}, {99,95}, {111,148}, {112,255}, {113,187}, {126,58}, {127,148}, {128,58},
+  /*  6 */ {54,162}, {55,116}, {68,168}, {69,255}, {70,197}, {82,116}, {83,248}, {84,243}, {85,95}, {96,58}, {97,230}, {98,254}, {99,152}, {111,148}, {112,255}, {113,197}, {126,58}, {127,148}, {128,58},
+  /*  7 */ {54,74}, {55,95}, {68,85}, {69,238}, {70,237}, {82,58}, {83,232}, {84,255}, {85,180}, {96,58}, {97,221}, {98,255}, {99,195}, {111,148}, {112,255}, {113,208}, {126,58}, {127,148}, {128,58},
+  /*  8 */ {69,180}, {70,237}, {71,95}, {83,195}, {84,255}, {85,238}, {86,74}, {96,58}, {97,208}, {98,255}, {99,232}, {100,85}, {111,148}, {112,255}, {113,221}, {114,58}, {126,58}, {127,148}, {128,58},
+  /*  9 */ {69,95}, {70,197}, {71,116}, {83,152}, {84,243}, {85,255}, {86,162}, {96,58}, {97,197}, {98,254}, {99,248}, {100,168}, {111,148}, {112,255}, {113,230}, {114,116}, {126,58}, {127,148}, {128,58},
+  /* 10 */ {70,121}, {71,95}, {83,95}, {84,210}, {85,254}, {86,210}, {96,58}, {97,187}, {98,249}, {99,255}, {100,225}, {101,121}, {111,148}, {112,255}, {113,238}, {114,159}, {126,58}, {127,148}, {128,58},
+  /* 11 */ {84,159}, {85,225}, {86,208}, {96,58}, {97,180}, {98,237}, {99,255}, {100,252}, {101,192}, {111,148}, {112,255}, {113,246}, {114,197}, {115,103}, {126,58}, {127,148}, {128,74},
+  /* 12 */ {84,74}, {85,168}, {86,174}, {96,58}, {97,174}, {98,219}, {99,251}, {100,255}, {101,243}, {111,148}, {112,255}, {113,252}, {114,223}, {115,177}, {116,85}, {126,58}, {127,152}, {128,85},
+  /* 13 */ {86,95}, {96,58}, {97,165}, {98,203}, {99,228}, {100,251}, {101,251}, {102,58}, {111,148}, {112,255}, {113,255}, {114,245}, {115,223}, {116,185}, {126,58}, {127,152}, {128,116},
+  /* 14 */ {96,58}, {97,162}, {98,185}, {99,199}, {100,216}, {101,216}, {102,74}, {111,148}, {112,255}, {113,255}, {114,255}, {115,255}, {116,238}, {117,85}, {126,58}, {127,152}, {128,144}, {129,109},
+  /* 15 */ {96,58}, {97,152}, {98,155}, {99,155}, {100,155}, {101,144}, {111,148}, {112,255}, {113,255}, {114,255}, {115,255}, {116,255}, {117,109}, {126,58}, {127,152}, {128,155}, {129,155}, {130,155}, {131,144},
+  /* 16 */ {96,58}, {97,152}, {98,144}, {99,109}, {111,148}, {112,255}, {113,255}, {114,255}, {115,255}, {116,238}, {117,85}, {126,58}, {127,162}, {128,185}, {129,199}, {130,216}, {131,216}, {132,74},
+  /* 17 */ {96,58}, {97,152}, {98,116}, {111,148}, {112,255}, {113,255}, {114,245}, {115,223}, {116,185}, {126,58}, {127,165}, {128,203}, {129,228}, {130,251}, {131,251}, {132,58}, {146,95},
+  /* 18 */ {96,58}, {97,152}, {98,85}, {111,148}, {112,255}, {113,252}, {114,223}, {115,177}, {116,85}, {126,58}, {127,174}, {128,219}, {129,251}, {130,255}, {131,243}, {144,74}, {145,168}, {146,174},
+  /* 19 */ {96,58}, {97,148}, {98,74}, {111,148}, {112,255}, {113,246}, {114,197}, {115,103}, {126,58}, {127,180}, {128,237}, {129,255}, {130,252}, {131,192}, {144,159}, {145,225}, {146,208},
+  /* 20 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,238}, {114,159}, {126,58}, {127,187}, {128,249}, {129,255}, {130,225}, {131,121}, {143,95}, {144,210}, {145,254}, {146,210}, {160,121}, {161,95},
+  /* 21 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,230}, {114,116}, {126,58}, {127,197}, {128,254}, {129,248}, {130,168}, {143,152}, {144,243}, {145,255}, {146,162}, {159,95}, {160,197}, {161,116},
+  /* 22 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,221}, {114,58}, {126,58}, {127,208}, {128,255}, {129,232}, {130,85}, {143,195}, {144,255}, {145,238}, {146,74}, {159,180}, {160,237}, {161,95},
+  /* 23 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,208}, {126,58}, {127,221}, {128,255}, {129,195}, {142,58}, {143,232}, {144,255}, {145,180}, {158,85}, {159,238}, {160,237}, {174,74}, {175,95},
+  /* 24 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,197}, {126,58}, {127,230}, {128,254}, {129,152}, {142,116}, {143,248}, {144,243}, {145,95}, {158,168}, {159,255}, {160,197}, {174,162}, {175,116},
+  /* 25 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,187}, {126,58}, {127,238}, {128,249}, {129,95}, {142,159}, {143,255}, {144,210}, {158,225}, {159,254}, {160,121}, {173,121}, {174,210}, {175,95},
+  /* 26 */ {96,58}, {97,148}, {98,58}, {111,148}, {112,255}, {113,180}, {126,74}, {127,246}, {128,237}, {142,197}, {143,255}, {144,159}, {157,103}, {158,252}, {159,225}, {173,192}, {174,208},
+  /* 27 */ {96,58}, {97,148}, {98,58}, {111,152}, {112,255}, {113,174}, {126,85}, {127,252}, {128,219}, {142,223}, {143,251}, {144,74}, {157,177}, {158,255}, {159,168}, {172,85}, {173,243}, {174,174},
+  /* 28 */ {96,58}, {97,148}, {98,58}, {111,152}, {112,255}, {113,165}, {126,116}, {127,255}, {128,203}, {142,245}, {143,228}, {157,223}, {158,251}, {172,185}, {173,251}, {174,95}, {188,58},
+  /* 29 */ {96,58}, {97,148}, {98,58}, {111,152}, {112,255}, {113,162}, {126,144}, {127,255}, {128,185}, {141,109}, {142,255}, {143,199}, {157,255}, {158,216}, {172,238}, {173,216}, {187,85}, {188,74},
+  /* 30 */ {96,58}, {97,148}, {98,58}, {111,152}, {112,255}, {113,152}, {126,155}, {127,255}, {128,155}, {141,155}, {142,255}, {143,155}, {156,155}, {157,255}, {158,155}, {171,144}, {172,255}, {173,144}, {187,109},
+  /* 31 */ {96,58}, {97,148}, {98,58}, {111,162}, {112,255}, {113,152}, {126,185}, {127,255}, {128,144}, {141,199}, {142,255}, {143,109}, {156,216}, {157,255}, {171,216}, {172,238}, {186,74}, {187,85},
+  /* 32 */ {96,58}, {97,148}, {98,58}, {111,165}, {112,255}, {113,152}, {126,203}, {127,255}, {128,116}, {141,228}, {142,245}, {156,251}, {157,223}, {170,95}, {171,251}, {172,185}, {186,58},
+  /* 33 */ {96,58}, {97,148}, {98,58}, {111,174}, {112,255}, {113,152}, {126,219}, {127,252}, {128,85}, {140,74}, {141,251}, {142,223}, {155,168}, {156,255}, {157,177}, {170,174}, {171,243}, {172,85},
+  /* 34 */ {96,58}, {97,148}, {98,58}, {111,180}, {112,255}, {113,148}, {126,237}, {127,246}, {128,74}, {140,159}, {141,255}, {142,197}, {155,225}, {156,252}, {157,103}, {170,208}, {171,192},
+  /* 35 */ {96,58}, {97,148}, {98,58}, {111,187}, {112,255}, {113,148}, {125,95}, {126,249}, {127,238}, {128,58}, {140,210}, {141,255}, {142,159}, {154,121}, {155,254}, {156,225}, {169,95}, {170,210}, {171,121},
+  /* 36 */ {96,58}, {97,148}, {98,58}, {111,197}, {112,255}, {113,148}, {125,152}, {126,254}, {127,230}, {128,58}, {139,95}, {140,243}, {141,248}, {142,116}, {154,197}, {155,255}, {156,168}, {169,116}, {170,162},
+  /* 37 */ {96,58}, {97,148}, {98,58}, {111,208}, {112,255}, {113,148}, {125,195}, {126,255}, {127,221}, {128,58}, {139,180}, {140,255}, {141,232}, {142,58}, {154,237}, {155,238}, {156,85}, {169,95}, {170,74},
+  /* 38 */ {96,58}, {97,148}, {98,58}, {110,58}, {111,221}, {112,255}, {113,148}, {124,85}, {125,232}, {126,255}, {127,208}, {128,58}, {138,74}, {139,238}, {140,255}, {141,195}, {153,95}, {154,237}, {155,180},
+  /* 39 */ {96,58}, {97,148}, {98,58}, {110,116}, {111,230}, {112,255}, {113,148}, {124,168}, {125,248}, {126,254}, {127,197}, {128,58}, {138,162}, {139,255}, {140,243}, {141,152}, {153,116}, {154,197}, {155,95},
+  /* 40 */ {96,58}, {97,148}, {98,58}, {110,159}, {111,238}, {112,255}, {113,148}, {123,121}, {124,225}, {125,255}, {126,249}, {127,187}, {128,58}, {138,210}, {139,254}, {140,210}, {141,95}, {153,95}, {154,121},
+  /* 41 */ {96,74}, {97,148}, {98,58}, {109,103}, {110,197}, {111,246}, {112,255}, {113,148}, {123,192}, {124,252}, {125,255}, {126,237}, {127,180}, {128,58}, {138,208}, {139,225}, {140,159},
+  /* 42 */ {96,85}, {97,152}, {98,58}, {108,85}, {109,177}, {110,223}, {111,252}, {112,255}, {113,148}, {123,243}, {124,255}, {125,251}, {126,219}, {127,174}, {128,58}, {138,174}, {139,168}, {140,74},
+  /* 43 */ {96,116}, {97,152}, {98,58}, {108,185}, {109,223}, {110,245}, {111,255}, {112,255}, {113,148}, {122,58}, {123,251}, {124,251}, {125,228}, {126,203}, {127,165}, {128,58}, {138,95},
+  /* 44 */ {95,109}, {96,144}, {97,152}, {98,58}, {107,85}, {108,238}, {109,255}, {110,255}, {111,255}, {112,255}, {113,148}, {122,74}, {123,216}, {124,216}, {125,199}, {126,185}, {127,162}, {128,58},
+  /* 45 */ {93,144}, {94,155}, {95,155}, {96,155}, {97,152}, {98,58}, {107,109}, {108,255}, {109,255}, {110,255}, {111,255}, {112,255}, {113,148}, {123,144}, {124,155}, {125,155}, {126,155}, {127,152}, {128,58},
+  /* 46 */ {92,74}, {93,216}, {94,216}, {95,199}, {96,185}, {97,162}, {98,58}, {107,85}, {108,238}, {109,255}, {110,255}, {111,255}, {112,255}, {113,148}, {125,109}, {126,144}, {127,152}, {128,58},
+  /* 47 */ {78,95}, {92,58}, {93,251}, {94,251}, {95,228}, {96,203}, {97,165}, {98,58}, {108,185}, {109,223}, {110,245}, {111,255}, {112,255}, {113,148}, {126,116}, {127,152}, {128,58},
+  /* 48 */ {78,174}, {79,168}, {80,74}, {93,243}, {94,255}, {95,251}, {96,219}, {97,174}, {98,58}, {108,85}, {109,177}, {110,223}, {111,252}, {112,255}, {113,148}, {126,85}, {127,152}, {128,58},
+  /* 49 */ {78,208}, {79,225}, {80,159}, {93,192}, {94,252}, {95,255}, {96,237}, {97,180}, {98,58}, {109,103}, {110,197}, {111,246}, {112,255}, {113,148}, {126,74}, {127,148}, {128,58},
+  /* 50 */ {63,95}, {64,121}, {78,210}, {79,254}, {80,210}, {81,95}, {93,121}, {94,225}, {95,255}, {96,249}, {97,187}, {98,58}, {110,159}, {111,238}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 51 */ {63,116}, {64,197}, {65,95}, {78,162}, {79,255}, {80,243}, {81,152}, {94,168}, {95,248}, {96,254}, {97,197}, {98,58}, {110,116}, {111,230}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 52 */ {63,95}, {64,237}, {65,180}, {78,74}, {79,238}, {80,255}, {81,195}, {94,85}, {95,232}, {96,255}, {97,208}, {98,58}, {110,58}, {111,221}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 53 */ {49,95}, {50,74}, {64,237}, {65,238}, {66,85}, {79,180}, {80,255}, {81,232}, {82,58}, {95,195}, {96,255}, {97,221}, {98,58}, {111,208}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 54 */ {49,116}, {50,162}, {64,197}, {65,255}, {66,168}, {79,95}, {80,243}, {81,248}, {82,116}, {95,152}, {96,254}, {97,230}, {98,58}, {111,197}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 55 */ {49,95}, {50,210}, {51,121}, {64,121}, {65,254}, {66,225}, {80,210}, {81,255}, {82,159}, {95,95}, {96,249}, {97,238}, {98,58}, {111,187}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 56 */ {50,208}, {51,192}, {65,225}, {66,252}, {67,103}, {80,159}, {81,255}, {82,197}, {96,237}, {97,246}, {98,74}, {111,180}, {112,255}, {113,148}, {126,58}, {127,148}, {128,58},
+  /* 57 */ {50,174}, {51,243}, {52,85}, {65,168}, {66,255}, {67,177}, {80,74}, {81,251}, {82,223}, {96,219}, {97,252}, {98,85}, {111,174}, {112,255}, {113,152}, {126,58}, {127,148}, {128,58},
+  /* 58 */ {36,58}, {50,95}, {51,251}, {52,185}, {66,251}, {67,223}, {81,228}, {82,245}, {96,203}, {97,255}, {98,116}, {111,165}, {112,255}, {113,152}, {126,58}, {127,148}, {128,58},
+  /* 59 */ {36,74}, {37,85}, {51,216}, {52,238}, {66,216}, {67,255}, {81,199}, {82,255}, {83,109}, {96,185}, {97,255}, {98,144}, {111,162}, {112,255}, {113,152}, {126,58}, {127,148}, {128,58},
+  // minute: 0.90 R, 1.1 px wide, peak 255
+  /*  0 */ {7,162}, {22,255}, {37,255}, {52,255}, {67,255}, {82,255}, {97,255}, {112,252},
+  /*  1 */ {7,95}, {8,131}, {22,187}, {23,221}, {37,201}, {38,210}, {52,216}, {53,197}, {67,230}, {68,180}, {82,240}, {83,155}, {97,251}, {98,131}, {112,252}, {113,85},
+  /*  2 */ {8,121}, {9,58}, {23,233}, {24,168}, {37,74}, {38,252}, {39,121}, {52,144}, {53,248}, {67,190}, {68,223}, {82,218}, {83,197}, {97,240}, {98,162}, {112,252}, {113,95},
+  /*  3 */ {23,127}, {24,246}, {38,190}, {39,223}, {53,232}, {54,182}, {67,116}, {68,254}, {69,103}, {82,190}, {83,228}, {97,232}, {98,182}, {112,251}, {113,103},
+  /*  4 */ {24,177}, {25,187}, {38,58}, {39,242}, {40,171}, {53,168}, {54,243}, {55,58}, {68,232}, {69,190}, {82,144}, {83,249}, {84,85}, {97,219}, {98,206}, {112,251}, {113,116},
+  /*  5 */ {25,180}, {26,95}, {39,155}, {40,249}, {41,95}, {53,58}, {54,237}, {55,192}, {68,185}, {69,240}, {70,58}, {82,95}, {83,248}, {84,162}, {97,206}, {98,227}, {112,251}, {113,131},
+  /*  6 */ {25,58}, {26,95}, {40,206}, {41,221}, {54,162}, {55,251}, {56,127}, {68,109}, {69,246}, {70,177}, {83,227}, {84,218}, {97,192}, {98,242}, {99,85}, {112,251}, {113,144},
+  /*  7 */ {40,58}, {41,210}, {42,127}, {55,218}, {56,233}, {57,85}, {69,206}, {70,240}, {71,109}, {83,190}, {84,246}, {85,127}, {97,171}, {98,251}, {99,140}, {112,251}, {113,155},
+  /*  8 */ {41,85}, {42,127}, {55,109}, {56,233}, {57,210}, {69,127}, {70,240}, {71,218}, {72,58}, {83,140}, {84,246}, {85,206}, {97,155}, {98,251}, {99,190}, {112,251}, {113,171},
+  /*  9 */ {56,127}, {57,221}, {58,95}, {70,177}, {71,251}, {72,206}, {73,58}, {83,85}, {84,218}, {85,246}, {86,162}, {97,144}, {98,242}, {99,227}, {100,109}, {112,251}, {113,192},
+  /* 10 */ {57,95}, {58,95}, {70,58}, {71,192}, {72,249}, {73,180}, {84,162}, {85,240}, {86,237}, {87,155}, {97,131}, {98,227}, {99,248}, {100,185}, {101,58}, {112,251}, {113,206}, {114,95},
+  /* 11 */ {71,58}, {72,171}, {73,187}, {84,85}, {85,190}, {86,243}, {87,242}, {88,177}, {97,116}, {98,206}, {99,249}, {100,232}, {101,168}, {102,58}, {112,251}, {113,219}, {114,144},
+  /* 12 */ {85,103}, {86,182}, {87,223}, {88,246}, {97,103}, {98,182}, {99,228}, {100,254}, {101,232}, {102,190}, {103,127}, {112,251}, {113,232}, {114,190}, {115,116},
+  /* 13 */ {87,121}, {88,168}, {89,58}, {97,95}, {98,162}, {99,197}, {100,223}, {101,248}, {102,252}, {103,233}, {104,121}, {112,252}, {113,240}, {114,218}, {115,190}, {116,144}, {117,74},
+  /* 14 */ {97,85}, {98,131}, {99,155}, {100,180}, {101,197}, {102,210}, {103,221}, {104,131}, {112,252}, {113,251}, {114,240}, {115,230}, {116,216}, {117,201}, {118,187}, {119,95},
+  /* 15 */ {112,252}, {113,255}, {114,255}, {115,255}, {116,255}, {117,255}, {118,255}, {119,162},
+  /* 16 */ {112,252}, {113,251}, {114,240}, {115,230}, {116,216}, {117,201}, {118,187}, {119,95}, {127,85}, {128,131}, {129,155}, {130,180}, {131,197}, {132,210}, {133,221}, {134,131},
+  /* 17 */ {112,252}, {113,240}, {114,218}, {115,190}, {116,144}, {117,74}, {127,95}, {128,162}, {129,197}, {130,223}, {131,248}, {132,252}, {133,233}, {134,121}, {147,121}, {148,168}, {149,58},
+  /* 18 */ {112,251}, {113,232}, {114,190}, {115,116}, {127,103}, {128,182}, {129,228}, {130,254}, {131,232}, {132,190}, {133,127}, {145,103}, {146,182}, {147,223}, {148,246},
+  /* 19 */ {112,251}, {113,219}, {114,144}, {127,116}, {128,206}, {129,249}, {130,232}, {131,168}, {132,58}, {144,85}, {145,190}, {146,243}, {147,242}, {148,177}, {161,58}, {162,171}, {163,187},
+  /* 20 */ {112,251}, {113,206}, {114,95}, {127,131}, {128,227}, {129,248}, {130,185}, {131,58}, {144,162}, {145,240}, {146,237}, {147,155}, {160,58}, {161,192}, {162,249}, {163,180}, {177,95}, {178,95},
+  /* 21 */ {112,251}, {113,192}, {127,144}, {128,242}, {129,227}, {130,109}, {143,85}, {144,218}, {145,246}, {146,162}, {160,177}, {161,251}, {162,206}, {163,58}, {176,127}, {177,221}, {178,95},
+  /* 22 */ {112,251}, {113,171}, {127,155}, {128,251}, {129,190}, {143,140}, {144,246}, {145,206}, {159,127}, {160,240}, {161,218}, {162,58}, {175,109}, {176,233}, {177,210}, {191,85}, {192,127},
+  /* 23 */ {112,251}, {113,155}, {127,171}, {128,251}, {129,140}, {143,190}, {144,246}, {145,127}, {159,206}, {160,240}, {161,109}, {175,218}, {176,233}, {177,85}, {190,58}, {191,210}, {192,127},
+  /* 24 */ {112,251}, {113,144}, {127,192}, {128,242}, {129,85}, {143,227}, {144,218}, {158,109}, {159,246}, {160,177}, {174,162}, {175,251}, {176,127}, {190,206}, {191,221}, {205,58}, {206,95},
+  /* 25 */ {112,251}, {113,131}, {127,206}, {128,227}, {142,95}, {143,248}, {144,162}, {158,185}, {159,240}, {160,58}, {173,58}, {174,237}, {175,192}, {189,155}, {190,249}, {191,95}, {205,180}, {206,95},
+  /* 26 */ {112,251}, {113,116}, {127,219}, {128,206}, {142,144}, {143,249}, {144,85}, {158,232}, {159,190}, {173,168}, {174,243}, {175,58}, {188,58}, {189,242}, {190,171}, {204,177}, {205,187},
+  /* 27 */ {112,251}, {113,103}, {127,232}, {128,182}, {142,190}, {143,228}, {157,116}, {158,254}, {159,103}, {173,232}, {174,182}, {188,190}, {189,223}, {203,127}, {204,246},
+  /* 28 */ {112,252}, {113,95}, {127,240}, {128,162}, {142,218}, {143,197}, {157,190}, {158,223}, {172,144}, {173,248}, {187,74}, {188,252}, {189,121}, {203,233}, {204,168}, {218,121}, {219,58},
+  /* 29 */ {112,252}, {113,85}, {127,251}, {128,131}, {142,240}, {143,155}, {157,230}, {158,180}, {172,216}, {173,197}, {187,201}, {188,210}, {202,187}, {203,221}, {217,95}, {218,131},
+  /* 30 */ {112,252}, {127,255}, {142,255}, {157,255}, {172,255}, {187,255}, {202,255}, {217,162},
+  /* 31 */ {111,85}, {112,252}, {126,131}, {127,251}, {141,155}, {142,240}, {156,180}, {157,230}, {171,197}, {172,216}, {186,210}, {187,201}, {201,221}, {202,187}, {216,131}, {217,95},
+  /* 32 */ {111,95}, {112,252}, {126,162}, {127,240}, {141,197}, {142,218}, {156,223}, {157,190}, {171,248}, {172,144}, {185,121}, {186,252}, {187,74}, {200,168}, {201,233}, {215,58}, {216,121},
+  /* 33 */ {111,103}, {112,251}, {126,182}, {127,232}, {141,228}, {142,190}, {155,103}, {156,254}, {157,116}, {170,182}, {171,232}, {185,223}, {186,190}, {200,246}, {201,127},
+  /* 34 */ {111,116}, {112,251}, {126,206}, {127,219}, {140,85}, {141,249}, {142,144}, {155,190}, {156,232}, {169,58}, {170,243}, {171,168}, {184,171}, {185,242}, {186,58}, {199,187}, {200,177},
+  /* 35 */ {111,131}, {112,251}, {126,227}, {127,206}, {140,162}, {141,248}, {142,95}, {154,58}, {155,240}, {156,185}, {169,192}, {170,237}, {171,58}, {183,95}, {184,249}, {185,155}, {198,95}, {199,180},
+  /* 36 */ {111,144}, {112,251}, {125,85}, {126,242}, {127,192}, {140,218}, {141,227}, {154,177}, {155,246}, {156,109}, {168,127}, {169,251}, {170,162}, {183,221}, {184,206}, {198,95}, {199,58},
+  /* 37 */ {111,155}, {112,251}, {125,140}, {126,251}, {127,171}, {139,127}, {140,246}, {141,190}, {153,109}, {154,240}, {155,206}, {167,85}, {168,233}, {169,218}, {182,127}, {183,210}, {184,58},
+  /* 38 */ {111,171}, {112,251}, {125,190}, {126,251}, {127,155}, {139,206}, {140,246}, {141,140}, {152,58}, {153,218}, {154,240}, {155,127}, {167,210}, {168,233}, {169,109}, {182,127}, {183,85},
+  /* 39 */ {111,192}, {112,251}, {124,109}, {125,227}, {126,242}, {127,144}, {138,162}, {139,246}, {140,218}, {141,85}, {151,58}, {152,206}, {153,251}, {154,177}, {166,95}, {167,221}, {168,127},
+  /* 40 */ {110,95}, {111,206}, {112,251}, {123,58}, {124,185}, {125,248}, {126,227}, {127,131}, {137,155}, {138,237}, {139,240}, {140,162}, {151,180}, {152,249}, {153,192}, {154,58}, {166,95}, {167,95},
+  /* 41 */ {110,144}, {111,219}, {112,251}, {122,58}, {123,168}, {124,232}, {125,249}, {126,206}, {127,116}, {136,177}, {137,242}, {138,243}, {139,190}, {140,85}, {151,187}, {152,171}, {153,58},
+  /* 42 */ {109,116}, {110,190}, {111,232}, {112,251}, {121,127}, {122,190}, {123,232}, {124,254}, {125,228}, {126,182}, {127,103}, {136,246}, {137,223}, {138,182}, {139,103},
+  /* 43 */ {107,74}, {108,144}, {109,190}, {110,218}, {111,240}, {112,252}, {120,121}, {121,233}, {122,252}, {123,248}, {124,223}, {125,197}, {126,162}, {127,95}, {135,58}, {136,168}, {137,121},
+  /* 44 */ {105,95}, {106,187}, {107,201}, {108,216}, {109,230}, {110,240}, {111,251}, {112,252}, {120,131}, {121,221}, {122,210}, {123,197}, {124,180}, {125,155}, {126,131}, {127,85},
+  /* 45 */ {105,162}, {106,255}, {107,255}, {108,255}, {109,255}, {110,255}, {111,255}, {112,252},
+  /* 46 */ {90,131}, {91,221}, {92,210}, {93,197}, {94,180}, {95,155}, {96,131}, {97,85}, {105,95}, {106,187}, {107,201}, {108,216}, {109,230}, {110,240}, {111,251}, {112,252},
+  /* 47 */ {75,58}, {76,168}, {77,121}, {90,121}, {91,233}, {92,252}, {93,248}, {94,223}, {95,197}, {96,162}, {97,95}, {107,74}, {108,144}, {109,190}, {110,218}, {111,240}, {112,252},
+  /* 48 */ {76,246}, {77,223}, {78,182}, {79,103}, {91,127}, {92,190}, {93,232}, {94,254}, {95,228}, {96,182}, {97,103}, {109,116}, {110,190}, {111,232}, {112,251},
+  /* 49 */ {61,187}, {62,171}, {63,58}, {76,177}, {77,242}, {78,243}, {79,190}, {80,85}, {92,58}, {93,168}, {94,232}, {95,249}, {96,206}, {97,116}, {110,144}, {111,219}, {112,251},
+  /* 50 */ {46,95}, {47,95}, {61,180}, {62,249}, {63,192}, {64,58}, {77,155}, {78,237}, {79,240}, {80,162}, {93,58}, {94,185}, {95,248}, {96,227}, {97,131}, {110,95}, {111,206}, {112,251},
+  /* 51 */ {46,95}, {47,221}, {48,127}, {61,58}, {62,206}, {63,251}, {64,177}, {78,162}, {79,246}, {80,218}, {81,85}, {94,109}, {95,227}, {96,242}, {97,144}, {111,192}, {112,251},
+  /* 52 */ {32,127}, {33,85}, {47,210}, {48,233}, {49,109}, {62,58}, {63,218}, {64,240}, {65,127}, {79,206}, {80,246}, {81,140}, {95,190}, {96,251}, {97,155}, {111,171}, {112,251},
+  /* 53 */ {32,127}, {33,210}, {34,58}, {47,85}, {48,233}, {49,218}, {63,109}, {64,240}, {65,206}, {79,127}, {80,246}, {81,190}, {95,140}, {96,251}, {97,171}, {111,155}, {112,251},
+  /* 54 */ {18,95}, {19,58}, {33,221}, {34,206}, {48,127}, {49,251}, {50,162}, {64,177}, {65,246}, {66,109}, {80,218}, {81,227}, {95,85}, {96,242}, {97,192}, {111,144}, {112,251},
+  /* 55 */ {18,95}, {19,180}, {33,95}, {34,249}, {35,155}, {49,192}, {50,237}, {51,58}, {64,58}, {65,240}, {66,185}, {80,162}, {81,248}, {82,95}, {96,227}, {97,206}, {111,131}, {112,251},
+  /* 56 */ {19,187}, {20,177}, {34,171}, {35,242}, {36,58}, {49,58}, {50,243}, {51,168}, {65,190}, {66,232}, {80,85}, {81,249}, {82,144}, {96,206}, {97,219}, {111,116}, {112,251},
+  /* 57 */ {20,246}, {21,127}, {35,223}, {36,190}, {50,182}, {51,232}, {65,103}, {66,254}, {67,116}, {81,228}, {82,190}, {96,182}, {97,232}, {111,103}, {112,251},
+  /* 58 */ {5,58}, {6,121}, {20,168}, {21,233}, {35,121}, {36,252}, {37,74}, {51,248}, {52,144}, {66,223}, {67,190}, {81,197}, {82,218}, {96,162}, {97,240}, {111,95}, {112,252},
+  /* 59 */ {6,131}, {7,95}, {21,221}, {22,187}, {36,210}, {37,201}, {51,197}, {52,216}, {66,180}, {67,230}, {81,155}, {82,240}, {96,131}, {97,251}, {111,85}, {112,252},
+  // second: 0.95 R, 0.6 px wide, peak 90
+  /*  0 */ {7,52}, {22,70}, {37,70}, {52,70}, {67,70}, {82,70}, {97,70}, {112,63},
+  /*  1 */ {7,26}, {8,48}, {22,48}, {23,67}, {37,56}, {38,60}, {52,63}, {53,54}, {67,70}, {68,43}, {82,75}, {97,75}, {112,66},
+  /*  2 */ {8,39}, {9,26}, {23,73}, {24,36}, {38,75}, {53,76}, {67,48}, {68,67}, {82,64}, {83,54}, {97,73}, {98,26}, {112,67},
+  /*  3 */ {9,30}, {24,76}, {38,49}, {39,67}, {53,71}, {54,41}, {68,77}, {82,46}, {83,69}, {97,69}, {98,45}, {112,67},
+  /*  4 */ {24,46}, {25,62}, {39,73}, {40,39}, {53,36}, {54,74}, {68,69}, {69,48}, {82,26}, {83,76}, {97,64}, {98,57}, {112,68},
+  /*  5 */ {25,56}, {26,30}, {39,33}, {40,77}, {54,71}, {55,48}, {68,45}, {69,73}, {83,77}, {84,33}, {97,56}, {98,66}, {112,68}, {113,20},
+  /*  6 */ {26,33}, {40,55}, {41,69}, {54,36}, {55,77}, {56,20}, {69,76}, {70,41}, {83,66}, {84,60}, {97,49}, {98,73}, {112,68}, {113,30},
+  /*  7 */ {41,64}, {42,43}, {55,60}, {56,69}, {69,54}, {70,73}, {83,46}, {84,75}, {85,20}, {97,39}, {98,78}, {99,30}, {112,69}, {113,33},
+  /*  8 */ {42,43}, {56,69}, {57,64}, {69,20}, {70,73}, {71,60}, {83,30}, {84,75}, {85,54}, {97,33}, {98,78}, {99,46}, {112,69}, {113,39},
+  /*  9 */ {56,20}, {57,69}, {58,33}, {70,41}, {71,77}, {72,55}, {84,60}, {85,76}, {86,36}, {97,30}, {98,73}, {99,66}, {112,68}, {113,49},
+  /* 10 */ {58,30}, {71,48}, {72,77}, {73,56}, {84,33}, {85,73}, {86,71}, {87,33}, {97,20}, {98,66}, {99,77}, {100,45}, {112,68}, {113,56},
+  /* 11 */ {72,39}, {73,62}, {85,48}, {86,74}, {87,73}, {88,46}, {98,57}, {99,76}, {100,69}, {101,36}, {112,68}, {113,64}, {114,26},
+  /* 12 */ {86,41}, {87,67}, {88,76}, {89,30}, {98,45}, {99,69}, {100,77}, {101,71}, {102,49}, {112,67}, {113,69}, {114,46},
+  /* 13 */ {88,36}, {89,26}, {98,26}, {99,54}, {100,67}, {101,76}, {102,75}, {103,73}, {104,39}, {112,67}, {113,73}, {114,64}, {115,48},
+  /* 14 */ {100,43}, {101,54}, {102,60}, {103,67}, {104,48}, {112,66}, {113,75}, {114,75}, {115,70}, {116,63}, {117,56}, {118,48}, {119,26},
+  /* 15 */ {112,63}, {113,70}, {114,70}, {115,70}, {116,70}, {117,70}, {118,70}, {119,52},
+  /* 16 */ {112,66}, {113,75}, {114,75}, {115,70}, {116,63}, {117,56}, {118,48}, {119,26}, {130,43}, {131,54}, {132,60}, {133,67}, {134,48},
+  /* 17 */ {112,67}, {113,73}, {114,64}, {115,48}, {128,26}, {129,54}, {130,67}, {131,76}, {132,75}, {133,73}, {134,39}, {148,36}, {149,26},
+  /* 18 */ {112,67}, {113,69}, {114,46}, {128,45}, {129,69}, {130,77}, {131,71}, {132,49}, {146,41}, {147,67}, {148,76}, {149,30},
+  /* 19 */ {112,68}, {113,64}, {114,26}, {128,57}, {129,76}, {130,69}, {131,36}, {145,48}, {146,74}, {147,73}, {148,46}, {162,39}, {163,62},
+  /* 20 */ {112,68}, {113,56}, {127,20}, {128,66}, {129,77}, {130,45}, {144,33}, {145,73}, {146,71}, {147,33}, {161,48}, {162,77}, {163,56}, {178,30},
+  /* 21 */ {112,68}, {113,49}, {127,30}, {128,73}, {129,66}, {144,60}, {145,76}, {146,36}, {160,41}, {161,77}, {162,55}, {176,20}, {177,69}, {178,33},
+  /* 22 */ {112,69}, {113,39}, {127,33}, {128,78}, {129,46}, {143,30}, {144,75}, {145,54}, {159,20}, {160,73}, {161,60}, {176,69}, {177,64}, {192,43},
+  /* 23 */ {112,69}, {113,33}, {127,39}, {128,78}, {129,30}, {143,46}, {144,75}, {145,20}, {159,54}, {160,73}, {175,60}, {176,69}, {191,64}, {192,43},
+  /* 24 */ {112,68}, {113,30}, {127,49}, {128,73}, {143,66}, {144,60}, {159,76}, {160,41}, {174,36}, {175,77}, {176,20}, {190,55}, {191,69}, {206,33},
+  /* 25 */ {112,68}, {113,20}, {127,56}, {128,66}, {143,77}, {144,33}, {158,45}, {159,73}, {174,71}, {175,48}, {189,33}, {190,77}, {205,56}, {206,30},
+  /* 26 */ {112,68}, {127,64}, {128,57}, {142,26}, {143,76}, {158,69}, {159,48}, {173,36}, {174,74}, {189,73}, {190,39}, {204,46}, {205,62},
+  /* 27 */ {112,67}, {127,69}, {128,45}, {142,46}, {143,69}, {158,77}, {173,71}, {174,41}, {188,49}, {189,67}, {204,76}, {219,30},
+  /* 28 */ {112,67}, {127,73}, {128,26}, {142,64}, {143,54}, {157,48}, {158,67}, {173,76}, {188,75}, {203,73}, {204,36}, {218,39}, {219,26},
+  /* 29 */ {112,66}, {127,75}, {142,75}, {157,70}, {158,43}, {172,63}, {173,54}, {187,56}, {188,60}, {202,48}, {203,67}, {217,26}, {218,48},
+  /* 30 */ {112,63}, {127,70}, {142,70}, {157,70}, {172,70}, {187,70}, {202,70}, {217,52},
+  /* 31 */ {112,66}, {127,75}, {142,75}, {156,43}, {157,70}, {171,54}, {172,63}, {186,60}, {187,56}, {201,67}, {202,48}, {216,48}, {217,26},
+  /* 32 */ {112,67}, {126,26}, {127,73}, {141,54}, {142,64}, {156,67}, {157,48}, {171,76}, {186,75}, {200,36}, {201,73}, {215,26}, {216,39},
+  /* 33 */ {112,67}, {126,45}, {127,69}, {141,69}, {142,46}, {156,77}, {170,41}, {171,71}, {185,67}, {186,49}, {200,76}, {215,30},
+  /* 34 */ {112,68}, {126,57}, {127,64}, {141,76}, {142,26}, {155,48}, {156,69}, {170,74}, {171,36}, {184,39}, {185,73}, {199,62}, {200,46},
+  /* 35 */ {111,20}, {112,68}, {126,66}, {127,56}, {140,33}, {141,77}, {155,73}, {156,45}, {169,48}, {170,71}, {184,77}, {185,33}, {198,30}, {199,56},
+  /* 36 */ {111,30}, {112,68}, {126,73}, {127,49}, {140,60}, {141,66}, {154,41}, {155,76}, {168,20}, {169,77}, {170,36}, {183,69}, {184,55}, {198,33},
+  /* 37 */ {111,33}, {112,69}, {125,30}, {126,78}, {127,39}, {139,20}, {140,75}, {141,46}, {154,73}, {155,54}, {168,69}, {169,60}, {182,43}, {183,64},
+  /* 38 */ {111,39}, {112,69}, {125,46}, {126,78}, {127,33}, {139,54}, {140,75}, {141,30}, {153,60}, {154,73}, {155,20}, {167,64}, {168,69}, {182,43},
+  /* 39 */ {111,49}, {112,68}, {125,66}, {126,73}, {127,30}, {138,36}, {139,76}, {140,60}, {152,55}, {153,77}, {154,41}, {166,33}, {167,69}, {168,20},
+  /* 40 */ {111,56}, {112,68}, {124,45}, {125,77}, {126,66}, {127,20}, {137,33}, {138,71}, {139,73}, {140,33}, {151,56}, {152,77}, {153,48}, {166,30},
+  /* 41 */ {110,26}, {111,64}, {112,68}, {123,36}, {124,69}, {125,76}, {126,57}, {136,46}, {137,73}, {138,74}, {139,48}, {151,62}, {152,39},
+  /* 42 */ {110,46}, {111,69}, {112,67}, {122,49}, {123,71}, {124,77}, {125,69}, {126,45}, {135,30}, {136,76}, {137,67}, {138,41},
+  /* 43 */ {109,48}, {110,64}, {111,73}, {112,67}, {120,39}, {121,73}, {122,75}, {123,76}, {124,67}, {125,54}, {126,26}, {135,26}, {136,36},
+  /* 44 */ {105,26}, {106,48}, {107,56}, {108,63}, {109,70}, {110,75}, {111,75}, {112,66}, {120,48}, {121,67}, {122,60}, {123,54}, {124,43},
+  /* 45 */ {105,52}, {106,70}, {107,70}, {108,70}, {109,70}, {110,70}, {111,70}, {112,63},
+  /* 46 */ {90,48}, {91,67}, {92,60}, {93,54}, {94,43}, {105,26}, {106,48}, {107,56}, {108,63}, {109,70}, {110,75}, {111,75}, {112,66},
+  /* 47 */ {75,26}, {76,36}, {90,39}, {91,73}, {92,75}, {93,76}, {94,67}, {95,54}, {96,26}, {109,48}, {110,64}, {111,73}, {112,67},
+  /* 48 */ {75,30}, {76,76}, {77,67}, {78,41}, {92,49}, {93,71}, {94,77}, {95,69}, {96,45}, {110,46}, {111,69}, {112,67},
+  /* 49 */ {61,62}, {62,39}, {76,46}, {77,73}, {78,74}, {79,48}, {93,36}, {94,69}, {95,76}, {96,57}, {110,26}, {111,64}, {112,68},
+  /* 50 */ {46,30}, {61,56}, {62,77}, {63,48}, {77,33}, {78,71}, {79,73}, {80,33}, {94,45}, {95,77}, {96,66}, {97,20}, {111,56}, {112,68},
+  /* 51 */ {46,33}, {47,69}, {48,20}, {62,55}, {63,77}, {64,41}, {78,36}, {79,76}, {80,60}, {95,66}, {96,73}, {97,30}, {111,49}, {112,68},
+  /* 52 */ {32,43}, {47,64}, {48,69}, {63,60}, {64,73}, {65,20}, {79,54}, {80,75}, {81,30}, {95,46}, {96,78}, {97,33}, {111,39}, {112,69},
+  /* 53 */ {32,43}, {33,64}, {48,69}, {49,60}, {64,73}, {65,54}, {79,20}, {80,75}, {81,46}, {95,30}, {96,78}, {97,39}, {111,33}, {112,69},
+  /* 54 */ {18,33}, {33,69}, {34,55}, {48,20}, {49,77}, {50,36}, {64,41}, {65,76}, {80,60}, {81,66}, {96,73}, {97,49}, {111,30}, {112,68},
+  /* 55 */ {18,30}, {19,56}, {34,77}, {35,33}, {49,48}, {50,71}, {65,73}, {66,45}, {80,33}, {81,77}, {96,66}, {97,56}, {111,20}, {112,68},
+  /* 56 */ {19,62}, {20,46}, {34,39}, {35,73}, {50,74}, {51,36}, {65,48}, {66,69}, {81,76}, {82,26}, {96,57}, {97,64}, {112,68},
+  /* 57 */ {5,30}, {20,76}, {35,67}, {36,49}, {50,41}, {51,71}, {66,77}, {81,69}, {82,46}, {96,45}, {97,69}, {112,67},
+  /* 58 */ {5,26}, {6,39}, {20,36}, {21,73}, {36,75}, {51,76}, {66,67}, {67,48}, {81,54}, {82,64}, {96,26}, {97,73}, {112,67},
+  /* 59 */ {6,48}, {7,26}, {21,67}, {22,48}, {36,60}, {37,56}, {51,54}, {52,63}, {66,43}, {67,70}, {82,75}, {97,75}, {112,66},
+};
+
+// hour marks on the rim, 12 o'clock first
+static const uint8_t FACE_MARKS[FACE_MARKS_N] = { 7, 25, 73, 119, 163, 205, 217, 199, 151, 105, 61, 19 };
@@ -1,4 +1,5 @@
 #include "fluid.h"
+#include "main.h"
 #include <math.h>
 #include <string.h>   // memset
 
@@ -39,9 +40,9 @@ void fluid_init(void) {
     }
 }
 
-void fluid_update(float ax, float ay, uint32_t dt_ms) {
+RAMFUNC void fluid_update(float ax, float ay, uint32_t dt_us) {
     // normalize dt to ~60 Hz baseline (16 ms)
-    float dt = dt_ms / 16.0f;
+    float dt = dt_us / 16000.0f;
 
     // map accel: rotate axes if needed
     Vector2D accel = {-ay, ax};
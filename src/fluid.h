@@ -19,7 +19,7 @@ typedef struct {
 } Particle;
 
 void fluid_init(void);
-void fluid_update(float ax, float ay, uint32_t dt_ms);
+void fluid_update(float ax, float ay, uint32_t dt_us);   // dt from sensor timestamps
 void fluid_draw(uint8_t *leds);   // 0 = off, 1 = on
 
 #endif
@@ -0,0 +1,248 @@
+#include "gfx.h"
+#include "led_driver.h"
+#include "profile.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+// sin over a quarter turn at i/64, Q15; Gfx_Sin interpolates and mirrors
+static const int16_t SIN_Q15[65] = {
+      0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+   6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+  12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+  18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+  23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+  27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+  30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+  32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+  32767,
+};
+
+int16_t Gfx_Sin(uint16_t angle)
+{
+  uint32_t q = angle >> 14;
+  uint32_t f = angle & 0x3FFFu;
+  if (q & 1u) f = 0x4000u - f;             // falling quadrants mirror the table
+  uint32_t i = f >> 8, t = f & 0xFFu;
+  int32_t a = SIN_Q15[i];
+  int32_t v = a + (((SIN_Q15[i + (i < 64u)] - a) * (int32_t)t) >> 8);
+  return (int16_t)((q & 2u) ? -v : v);
+}
+
+int16_t Gfx_Cos(uint16_t angle)
+{
+  return Gfx_Sin((uint16_t)(angle + 0x4000u));
+}
+
+static uint32_t isqrt32(uint32_t v)
+{
+  uint32_t r = 0, b = 1u << 30;
+  while (b > v) b >>= 2;
+  while (b) {
+    if (v >= r + b) { v -= r + b; r = (r >> 1) + b; }
+    else            { r >>= 1; }
+    b >>= 2;
+  }
+  return r;
+}
+
+// Coverage 0..256 → level-scaled fb write on a valid cell
+static inline void plot(int32_t x, int32_t y, int32_t cov, uint8_t level)
+{
+  if ((uint32_t)x >= COLS || (uint32_t)y >= ROWS || cov <= 0) return;
+  if (!VALID_MASK[y * COLS + x]) return;
+  if (cov > 255) cov = 255;
+  Display_MaxPixel((uint8_t)y, (uint8_t)x, (uint8_t)((level * (LED_AA_LEVEL[cov] + 1u)) >> 8));
+}
+
+#define SWAP16(a, b)  do { int16_t t_ = (a); (a) = (b); (b) = t_; } while (0)
+
+void Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t level)
+{
+  // walk the major axis one pixel at a time, splitting each step between
+  // the two minor-axis cells the line passes (Xiaolin Wu)
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep)   { SWAP16(x0, y0); SWAP16(x1, y1); }
+  if (x0 > x1) { SWAP16(x0, x1); SWAP16(y0, y1); }
+
+  int32_t dx   = x1 - x0;
+  int32_t grad = dx ? (int32_t)(((int64_t)(y1 - y0) << 16) / dx) : 0;   // Q16
+
+  int32_t first = (x0 + 128) >> 8;         // pixels holding the two ends
+  int32_t last  = (x1 + 128) >> 8;
+  int32_t major = steep ? ROWS - 1 : COLS - 1;
+  if (first < 0) first = 0;                // off-board steps cost nothing
+  if (last > major) last = major;
+
+  int32_t y = ((int32_t)y0 << 8) + (int32_t)(((int64_t)((first << 8) - x0) * grad) >> 8);
+  for (int32_t p = first; p <= last; ++p, y += grad) {
+    int32_t lo = (p << 8) - 128, hi = lo + 256;
+    if (lo < x0) lo = x0;                  // partial coverage at the ends
+    if (hi > x1) hi = x1;
+    int32_t span = dx ? hi - lo : 256;
+    if (span <= 0) continue;
+
+    int32_t yi = y >> 16;
+    int32_t f  = (y >> 8) & 0xFF;
+    int32_t ca = (span * (256 - f)) >> 8;
+    int32_t cb = (span * f) >> 8;
+    if (steep) { plot(yi, p, ca, level); plot(yi + 1, p, cb, level); }
+    else       { plot(p, yi, ca, level); plot(p, yi + 1, cb, level); }
+  }
+}
+
+/* Circles walk rows. Each row costs one square root for the outer chord
+   (radius + 1 px for the soft edge), cells are clipped to LED_ROW_SPAN
+   and only those near the edge take a per-cell distance. */
+typedef struct { int32_t y, dy2, x0, x1; } chord_row;
+
+static bool chord(int32_t cx, int32_t cy, int32_t ro, int32_t y, chord_row *c)
+{
+  int32_t dy = (y << 8) - cy;
+  int32_t h2 = ro * ro - dy * dy;
+  if (h2 <= 0) return false;
+  int32_t h  = (int32_t)isqrt32((uint32_t)h2);
+  int32_t x0 = (cx - h + 255) >> 8;        // ceil
+  int32_t x1 = (cx + h) >> 8;              // floor
+  if (x0 < LED_ROW_SPAN[y][0]) x0 = LED_ROW_SPAN[y][0];
+  if (x1 > LED_ROW_SPAN[y][1]) x1 = LED_ROW_SPAN[y][1];
+  if (x0 > x1) return false;
+  c->y = y; c->dy2 = dy * dy; c->x0 = x0; c->x1 = x1;
+  return true;
+}
+
+static inline int32_t row_first(int32_t cy, int32_t ro)
+{
+  int32_t y = (cy - ro + 255) >> 8;
+  return y < 0 ? 0 : y;
+}
+
+static inline int32_t row_last(int32_t cy, int32_t ro)
+{
+  int32_t y = (cy + ro) >> 8;
+  return y > ROWS - 1 ? ROWS - 1 : y;
+}
+
+void Gfx_FillCircle(int16_t cx, int16_t cy, int16_t r, uint8_t level)
+{
+  if (r <= 0) return;
+  int32_t ro = r + 128;                    // cells reach past r by half a pixel
+  int32_t ri = r - 128;                    // fully inside below this distance
+  int32_t ri2 = ri > 0 ? ri * ri : -1;
+
+  for (int32_t y = row_first(cy, ro); y <= row_last(cy, ro); ++y) {
+    chord_row c;
+    if (!chord(cx, cy, ro, y, &c)) continue;
+    for (int32_t x = c.x0; x <= c.x1; ++x) {
+      int32_t dx = (x << 8) - cx;
+      int32_t d2 = dx * dx + c.dy2;
+      int32_t cov = (d2 <= ri2) ? 256 : r + 128 - (int32_t)isqrt32((uint32_t)d2);
+      plot(x, y, cov, level);
+    }
+  }
+}
+
+void Gfx_Arc(int16_t cx, int16_t cy, int16_t r, uint16_t start, uint16_t sweep, uint8_t level)
+{
+  if (r <= 0 || !sweep) return;
+  int32_t ro  = r + 256;                   // 1 px stroke, soft on both sides
+  int32_t ri  = r - 256;
+  int32_t ri2 = ri > 0 ? ri * ri : -1;
+
+  // ends as unit vectors (Q15, y down); a cell is on the arc when it lies
+  // clockwise of the start and anticlockwise of the end
+  uint16_t end = (uint16_t)(start + sweep);
+  int32_t sx = Gfx_Sin(start), sy = -Gfx_Cos(start);
+  int32_t ex = Gfx_Sin(end),   ey = -Gfx_Cos(end);
+  bool full = sweep == GFX_FULL_TURN;
+  bool wide = sweep > 0x8000u;
+
+  for (int32_t y = row_first(cy, ro); y <= row_last(cy, ro); ++y) {
+    chord_row c;
+    if (!chord(cx, cy, ro, y, &c)) continue;
+    int32_t dy = (y << 8) - cy;
+    for (int32_t x = c.x0; x <= c.x1; ++x) {
+      int32_t dx = (x << 8) - cx;
+      int32_t d2 = dx * dx + c.dy2;
+      if (d2 <= ri2) continue;             // hole of the ring
+      if (!full) {
+        bool after_start = sx * dy - sy * dx >= 0;
+        bool before_end  = dx * ey - dy * ex >= 0;
+        if (wide ? !(after_start || before_end) : !(after_start && before_end)) continue;
+      }
+      int32_t d = (int32_t)isqrt32((uint32_t)d2);
+      plot(x, y, 256 - abs(d - r), level);
+    }
+  }
+}
+
+#ifdef LED_BENCH
+#include <math.h>
+
+/* Naive float baseline for Gfx_Bench: every cell of the board gets a
+   distance, a coverage and a powf, whether the shape is near it or not. */
+static void float_plot(int x, int y, float cov, uint8_t level)
+{
+  if (!VALID_MASK[y * COLS + x] || cov <= 0.0f) return;
+  if (cov > 1.0f) cov = 1.0f;
+  Display_MaxPixel((uint8_t)y, (uint8_t)x, (uint8_t)(level * powf(cov, 1.0f / 2.8f) + 0.5f));
+}
+
+static void float_line(float x0, float y0, float x1, float y1, uint8_t level)
+{
+  float dx = x1 - x0, dy = y1 - y0, len2 = dx * dx + dy * dy;
+  for (int y = 0; y < ROWS; ++y)
+    for (int x = 0; x < COLS; ++x) {
+      float t = len2 > 0.0f ? ((x - x0) * dx + (y - y0) * dy) / len2 : 0.0f;
+      t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+      float ex = x0 + t * dx - x, ey = y0 + t * dy - y;
+      float_plot(x, y, 1.0f - sqrtf(ex * ex + ey * ey), level);
+    }
+}
+
+static void float_circle(float cx, float cy, float r, uint8_t level)
+{
+  for (int y = 0; y < ROWS; ++y)
+    for (int x = 0; x < COLS; ++x)
+      float_plot(x, y, r + 0.5f - sqrtf((x - cx) * (x - cx) + (y - cy) * (y - cy)), level);
+}
+
+static void float_arc(float cx, float cy, float r, float a0, float a1, uint8_t level)
+{
+  for (int y = 0; y < ROWS; ++y)
+    for (int x = 0; x < COLS; ++x) {
+      float a = atan2f(x - cx, cy - y);    // clockwise from 12 o'clock
+      if (a < 0.0f) a += 6.2831853f;
+      if (a < a0 || a > a1) continue;
+      float d = sqrtf((x - cx) * (x - cx) + (y - cy) * (y - cy));
+      float_plot(x, y, 1.0f - fabsf(d - r), level);
+    }
+}
+
+// Spinner of 12 spokes, a centre dot and a 3/4 gauge ring
+void Gfx_Bench(uint32_t *fixed_cyc, uint32_t *float_cyc)
+{
+  const float c = (COLS - 1) / 2.0f, m = (ROWS - 1) / 2.0f;
+
+  Display_Clear();
+  uint32_t t0 = Profile_Cycles();
+  for (uint16_t i = 0; i < 12; ++i) {
+    uint16_t a = (uint16_t)(i * (65536u / 12u));
+    Gfx_Line((int16_t)(c * 256), (int16_t)(m * 256),
+             (int16_t)(c * 256 + ((Gfx_Sin(a) * 5) >> 7)),
+             (int16_t)(m * 256 - ((Gfx_Cos(a) * 5) >> 7)), 255);
+  }
+  Gfx_FillCircle((int16_t)(c * 256), (int16_t)(m * 256), GFX_PX(2), 255);
+  Gfx_Arc((int16_t)(c * 256), (int16_t)(m * 256), GFX_PX(6), 0, 0xC000u, 255);
+  *fixed_cyc = Profile_Cycles() - t0;
+
+  Display_Clear();
+  t0 = Profile_Cycles();
+  for (int i = 0; i < 12; ++i) {
+    float a = i * 6.2831853f / 12.0f;
+    float_line(c, m, c + 5.0f * sinf(a), m - 5.0f * cosf(a), 255);
+  }
+  float_circle(c, m, 2.0f, 255);
+  float_arc(c, m, 6.0f, 0.0f, 4.712389f, 255);
+  *float_cyc = Profile_Cycles() - t0;
+}
+#endif
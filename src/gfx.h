@@ -0,0 +1,21 @@
+#pragma once
+#include "main.h"
+
+// Anti-aliased primitives on the fb levels, all in Q8 fixed point: x is the
+// column, y the row, 256 = one pixel, pixel centres on whole pixels. Output
+// is clipped to VALID_MASK and max-blended, so shapes overlap without dark
+// seams. Coverage maps to level through LED_AA_LEVEL (inverse scan gamma).
+
+#define GFX_PX(n)        ((int16_t)((n) * 256))
+#define GFX_FULL_TURN    0xFFFFu     // sweep for a closed ring
+
+// Angles: 0 = 12 o'clock, clockwise, 65536 per turn
+void Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t level);   // Wu, 1 px
+void Gfx_Arc(int16_t cx, int16_t cy, int16_t r, uint16_t start, uint16_t sweep, uint8_t level); // 1 px stroke
+void Gfx_FillCircle(int16_t cx, int16_t cy, int16_t r, uint8_t level);
+int16_t Gfx_Sin(uint16_t angle);     // Q15
+int16_t Gfx_Cos(uint16_t angle);     // Q15
+
+#ifdef LED_BENCH
+void Gfx_Bench(uint32_t *fixed_cyc, uint32_t *float_cyc);   // same scene, CYCCNT each
+#endif
@@ -1,9 +1,16 @@
 // Core/Src/led_driver.c
 
 #include "led_driver.h"
+#include "face_tables.h"
 #include "main.h"
-#include <math.h>
+#include "anim.h"
+#include "app.h"
+#include "profile.h"
 #include <stdbool.h> 
+#include <stdio.h>
+#ifdef LED_BENCH
+#include <math.h>       // powf, for the pre-table gamma arm of Led_BenchGamma
+#endif
 
 // If BR_STEPS is not defined in your header, fall back to BR_LEVELS
 #ifndef BR_STEPS
@@ -21,38 +28,98 @@
 #define COL_D2      (COL_COLON + 1)
 #define COL_D3      (COL_D2 + HEX_W + 1)
 
-#define GAMMA     2.8f
 #define LUT_SIZE  256
 
-static uint16_t gamma_lut[LUT_SIZE];   // maps 0..255 → scaled CCR
-typedef struct { uint8_t hi, lo; uint16_t idx; } ScanEntry;
+/* Temporal dithering: gamma_lut and ccr_tab keep DITHER_BITS of fraction
+   below the CCR count. Each slot adds a per-pixel threshold that cycles
+   with the frame counter, so a pixel alternates between adjacent compare
+   values and averages to the fractional CCR over 1 << DITHER_BITS frames.
+   Phase is offset by pixel index, so neighbours never pulse together. */
+#define DITHER_BITS  2
+#define DITHER_N     (1u << DITHER_BITS)
+static const uint8_t DITHER_SEQ[DITHER_N] = { 0, 2, 1, 3 };   // 1D Bayer order
+static volatile uint8_t dither_frame;
+
+static uint16_t gamma_lut[LUT_SIZE];   // 0..255 → CCR × DITHER_N (LED_GAMMA_Q16 × ARR/2)
 
 /* -------- Framebuffer & active list -------- */
 static volatile uint8_t fb[N_PIXELS];   // per-pixel brightness (0..BR_STEPS-1)
 static ScanEntry act[N_PIXELS];         // active entries (pixels with fb>0)
-static int16_t pos_map[N_PIXELS];       // map pixel idx -> position in act[], -1 if inactive
+static volatile uint32_t fb_load;       // Σ LED_GAMMA_Q16[fb] over pixels that can light
+static uint8_t face_pos[FACE_HANDS];    // analog hand positions fb currently shows
+static bool    face_valid;              // false once anything else draws over the face
+static int16_t pos_map[N_PIXELS] = {   // map pixel idx -> position in act[], -1 if inactive
+  [0 ... N_PIXELS - 1] = -1
+};
 static uint16_t act_len;                // number of active pixels
 static uint16_t scan_pos;               // next position to scan (0..act_len-1)
 
-/* -------- Last driven pair tracking -------- */
-static int8_t last_hi = -1, last_lo = -1;
+/* -------- Last driven pixel (register images from LED_GPIO) -------- */
+static const LedGpio *last_gpio;        // NULL while every matrix pin is Hi-Z
 
 /* -------- Global brightness (0..BR_STEPS-1) -------- */
 static uint8_t g_master = (BR_STEPS > 0 ? BR_STEPS - 1 : 0);
 
+/* -------- Ready-to-load CCR per fb level, double-buffered --------
+   ccr_tab[ccr_front] is what the ISR reads. Led_SetGlobalBrightness fills
+   the other half and raises ccr_swap; the ISR flips at the next frame start
+   so one frame never mixes two brightness levels. */
+static uint16_t ccr_tab[2][LUT_SIZE];
+static volatile uint8_t ccr_front;
+static volatile bool    ccr_swap;
+static uint16_t ccr_master_q8[2];       // master each half was built for, Q8
+
+/* -------- LED current limit, re-evaluated at every frame start --------
+   One pixel is lit per slot, so supply current follows the mean on-time of
+   the lit pixels, not how many there are: fb_load / act_len × master.
+   lim_q8 scales the CCR when that exceeds lim_duty; g_master is left as the
+   requested level so the cap lifts again as soon as the frame gets darker. */
+static volatile uint32_t lim_duty;      // budget as mean duty, Q16; 0 = no limit
+static volatile uint16_t lim_q8 = 256;  // CCR scale for the running frame
+static volatile uint16_t led_duty;      // mean duty of the running frame after the cap, Q16
+
+/* -------- Brightness fade, stepped by the ISR at frame starts --------
+   While fade_on the slot path scales gamma_lut by fade_scale (Q8, 256 =
+   full) instead of reading ccr_tab. Led_FadeTo precomputes fade_tab and
+   the target table in the back half; after the last step the ISR flips to
+   that table and raises fade_end for Led_FadePoll. fade_step_slots =
+   FADE_HOLD freezes the ISR side while main context rewrites the tables. */
+#define FADE_STEPS  32
+#define FADE_HOLD   0xFFFFFFFFu
+static uint16_t fade_tab[FADE_STEPS];
+static volatile uint16_t fade_scale;
+static volatile uint8_t  fade_i;             // next fade_tab entry
+static volatile bool     fade_on, fade_arm, fade_end;
+static volatile uint32_t fade_slots;         // slots since the last step
+static volatile uint32_t fade_step_slots = FADE_HOLD;
+static void (*fade_done)(void);
+
+/* -------- Scan timing, written by the TIM2 hook --------
+   Cycles cover the body of Led_ScanSlotStart only; the HAL IRQ dispatch in
+   front of it is not included. Latency is TIM2->CNT on entry: with PSC=0
+   that is core clocks since the update event that started the slot. */
+static volatile uint32_t st_frames;     // passes over act[] that started
+static volatile uint32_t st_slots;
+static volatile uint32_t st_cyc_sum;
+static volatile uint16_t st_cyc_min = 0xFFFF, st_cyc_max;
+static volatile uint16_t st_lat_max;
+static uint32_t st_t0_ms, st_t0_cyc;    // window start (main context only)
+
+static volatile bool ambient;           // LPTIM1 owns the scan instead of TIM2
+
+#ifdef LED_BENCH
+static volatile uint32_t first_pixel_cyc;   // CYCCNT when the first LED was driven
+#endif
+
 /* -------- Timer handle (provided by Cube) -------- */
 extern TIM_HandleTypeDef htim2;
+extern LPTIM_HandleTypeDef hlptim1;     // ambient slot clock
 
 /* ---------------- GPIO low-level helpers ---------------- */
 static inline void pin_mode_input(const Pin *p){
   uint32_t sh = (uint32_t)p->pos * 2U;
   p->port->MODER &= ~(3U << sh);              // 00 = input (Hi-Z)
 }
-static inline void pin_mode_output(const Pin *p){
-  uint32_t sh = (uint32_t)p->pos * 2U;
-  p->port->MODER = (p->port->MODER & ~(3U << sh)) | (1U << sh); // 01 = output
-}
-static inline void pin_set(const Pin *p){ p->port->BSRR = p->pinmask; }
 static inline void pin_clr(const Pin *p){ p->port->BSRR = ((uint32_t)p->pinmask) << 16U; }
 
 static void all_hi_z(void){
@@ -62,32 +129,47 @@ static void all_hi_z(void){
   }
 }
 
-static void release_last(void){
-  if (last_hi >= 0){
-    pin_clr(&pins[last_hi]); pin_mode_input(&pins[last_hi]);
-    pin_clr(&pins[last_lo]); pin_mode_input(&pins[last_lo]);
-    last_hi = last_lo = -1;
+/* Scan-path helpers are forced inline so the SRAM and flash copies of the
+   slot handler (see Led_BenchScan) each carry their own body. Each pixel
+   has one MODER mask and one BSRR word per port (gen_led_tables.py), so a
+   slot is at most one BSRR write and one MODER read-modify-write per port;
+   the LED_N_PORTS loop unrolls. */
+#define MODER_OUT_BITS  0x55555555u     // 01 = general purpose output
+
+static inline __attribute__((always_inline)) void release_last(void){
+  const LedGpio *g = last_gpio;
+  if (!g) return;
+  for (int k = 0; k < LED_N_PORTS; ++k) {
+    if (!g->moder[k]) continue;
+    GPIO_TypeDef *port = LED_PORTS[k];
+    port->MODER &= ~g->moder[k];                     // 00 = input (Hi-Z)
+    port->BSRR   = (g->bsrr[k] & 0xFFFFu) << 16;     // drop the anode's ODR bit
   }
+  last_gpio = NULL;
 }
 
-static void drive_pair(uint8_t hi, uint8_t lo){
+static inline __attribute__((always_inline)) void drive_pixel(uint16_t idx){
   release_last();
-  const Pin *PH = &pins[hi], *PL = &pins[lo];
-  pin_mode_output(PL); pin_clr(PL);   // cathode LOW
-  pin_mode_output(PH); pin_set(PH);   // anode HIGH
-  last_hi = (int8_t)hi; last_lo = (int8_t)lo;
+  const LedGpio *g = &LED_GPIO[idx];
+  for (int k = 0; k < LED_N_PORTS; ++k) {
+    uint32_t m = g->moder[k];
+    if (!m) continue;
+    GPIO_TypeDef *port = LED_PORTS[k];
+    port->BSRR  = g->bsrr[k];                              // anode HIGH, cathode LOW, still Hi-Z
+    port->MODER = (port->MODER & ~m) | (m & MODER_OUT_BITS);
+  }
+  last_gpio = g;
 }
 
 /* --------------- Active list (incremental updates) --------------- */
 static inline void act_add(uint16_t idx){
   if (pos_map[idx] >= 0) return;                     // already active
-  if (!VALID_MASK[idx]) return;
-  CP_Step s = STEPS[idx];
-  if (s.hi >= N_PINS || s.lo >= N_PINS || s.hi == s.lo) return;
+  ScanEntry e = LED_SCAN[idx];                       // validated at build time
+  if (e.hi == LED_NO_PAIR) return;
 
   __disable_irq();                                   // tiny critical section
   int16_t pos = (int16_t)act_len;
-  act[pos] = (ScanEntry){ s.hi, s.lo, idx };
+  act[pos] = e;
   pos_map[idx] = pos;
   act_len++;
   __enable_irq();
@@ -111,178 +193,295 @@ static inline void act_remove(uint16_t idx){
 
 /* ----------------------- Public API ----------------------- */
 
-static float easeOutExpo(float t) {
-    return (t >= 1.0f) ? 1.0f : (1 - powf(2, -10 * t));
-}
+/* -------- Framebuffer write shared by every drawing path -------- */
+static uint16_t px_touched;              // fb cells changed since last read
 
-static float easeInExpo(float t) {
-    return (t <= 0.0f) ? 0.0f : powf(2, 10 * (t - 1));
+static inline void fb_write(uint16_t idx, uint8_t level)
+{
+  uint8_t old = fb[idx];
+  if (old == level) return;
+  fb[idx] = level;
+  px_touched++;
+  if (VALID_MASK[idx]) fb_load += (uint32_t)LED_GAMMA_Q16[level] - LED_GAMMA_Q16[old];
+
+  if (!old)          act_add(idx);
+  else if (!level)   act_remove(idx);
+  // else: brightness changed but remains active; leave position stable
 }
 
-void Led_CurtainReveal(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss)
-{
-    const int start_row = 7;
-    const int reveal_rows = 7;          // only move 4 rows away
-    const uint8_t line_level = BR_STEPS - 1;
-    const uint32_t frame_delay = 20;
-    const uint32_t start = HAL_GetTick();
+/* --------------- 1-bit plane: one word per row ---------------
+   Column c is bit (MONO_BITS - 1 - c), so font rows (MSB = leftmost pixel)
+   line up with a single shift. Glyphs are composed here with a few word
+   ops per row and reach fb only through Mono_Commit / Mono_CommitRect.
+   The word is 16 bits wide on boards up to 16 columns, 32 above that. */
+_Static_assert(COLS <= 32, "mono plane holds at most 32 columns per row");
+_Static_assert(ROWS <= 32, "row bitmaps (stale_rows) hold at most 32 rows");
+
+#if COLS <= 16
+typedef uint16_t mono_row_t;
+#define MONO_BITS  16
+#define MONO_ALL   0xFFFFu
+#else
+typedef uint32_t mono_row_t;
+#define MONO_BITS  32
+#define MONO_ALL   0xFFFFFFFFu
+#endif
+#define MONO_MSB         ((mono_row_t)(1u << (MONO_BITS - 1)))
+#define MONO_COLS_MASK   ((mono_row_t)(MONO_ALL << (MONO_BITS - COLS)))
+
+#if ROWS <= 16
+typedef uint16_t row_set_t;
+#define ROW_SET_ALL  ((row_set_t)(0xFFFFu >> (16 - ROWS)))
+#else
+typedef uint32_t row_set_t;
+#define ROW_SET_ALL  ((row_set_t)(0xFFFFFFFFu >> (32 - ROWS)))
+#endif
 
-    while (1) {
-        uint32_t now = HAL_GetTick();
-        uint32_t elapsed = now - start;
-        float t = (float)elapsed / (float)duration_ms;
-        if (t > 1.0f) t = 1.0f;
+static mono_row_t mono[ROWS];
 
-        float eased = easeInExpo(t);
+/* What Mono_Commit last put into fb, so the next commit only touches the
+   XOR. Rows written behind the plane's back (SetPixelRC, SetRegion, a
+   CommitRect at another level) are marked stale and get a full compare. */
+static mono_row_t mono_shown[ROWS];
+static uint8_t    mono_shown_level;
+static row_set_t  stale_rows;            // bit r = row r of fb may differ from mono_shown
 
-        // Offset goes from 0 → reveal_rows
-        int offset = (int)(eased * reveal_rows);
+#define ROW_BIT(r)   ((row_set_t)(1u << (r)))
 
-        int top = start_row - offset;
-        int bottom = start_row + offset;
+// w-bit glyph row placed with its leftmost pixel at column c0, clipped
+static inline mono_row_t mono_row_mask(uint8_t bits, uint8_t w, int8_t c0)
+{
+  if (c0 >= COLS || c0 + (int)w <= 0) return 0;     // off the board; keeps sh in range
+  int sh = MONO_BITS - (int)w - c0;
+  uint32_t m = (sh >= 0) ? ((uint32_t)bits << sh) : ((uint32_t)bits >> -sh);
+  return (mono_row_t)m & MONO_COLS_MASK;
+}
 
-        // Step 1: clear
-        Display_Clear();
+void Mono_Clear(void)
+{
+  for (uint8_t r = 0; r < ROWS; ++r) mono[r] = 0;
+}
 
-        // Step 2: draw clock
-        Led_DrawClock(hh, mm, ss);
+// columns [c0, c0 + w) as a row mask, clipped to the board
+static inline mono_row_t mono_span(int c0, int w)
+{
+  int a = c0 < 0 ? 0 : c0;
+  int b = (c0 + w > COLS) ? COLS : c0 + w;
+  if (a >= b) return 0;
+  return (mono_row_t)((0xFFFFFFFFu >> (32 - (b - a))) << (MONO_BITS - b));
+}
 
-        // Step 3: mask above top
-        if (top >= 0) {
-            Display_SetRegion(0, 0, COLS, top, 0);
-        }
-        // Step 4: mask below bottom
-        if (bottom + 1 < ROWS) {
-            Display_SetRegion(bottom + 1, 0, COLS, ROWS - (bottom + 1), 0);
-        }
+static inline void mono_apply(int rr, mono_row_t m, mono_row_t box, Mono_Op op)
+{
+  switch (op) {
+    case MONO_OR:     mono[rr] |= m;                       break;
+    case MONO_ANDNOT: mono[rr] &= (mono_row_t)~m;          break;
+    case MONO_XOR:    mono[rr] ^= m;                       break;
+    case MONO_COPY:   mono[rr] = (mono_row_t)((mono[rr] & ~box) | m); break;
+  }
+}
 
-        // Step 5: draw the moving lines themselves
-        if (top >= 0 && top < ROWS) {
-            for (int c = 0; c < COLS; c++)
-                Display_SetPixelRC(top, c, line_level);
-        }
-        if (bottom >= 0 && bottom < ROWS) {
-            for (int c = 0; c < COLS; c++)
-                Display_SetPixelRC(bottom, c, line_level);
-        }
+void Mono_Blit(int8_t r0, int8_t c0, const uint8_t *rows, uint8_t w, uint8_t h, Mono_Op op)
+{
+  mono_row_t box = mono_span(c0, w);    // glyph rows are 8 bits, boxes may span the board
+  for (uint8_t ry = 0; ry < h; ++ry) {
+    int rr = r0 + ry;
+    if (rr < 0 || rr >= ROWS) continue;
+    mono_row_t m = rows ? mono_row_mask(rows[ry], w, c0) : box;
+    mono_apply(rr, m, box, op);
+  }
+}
 
-        if (t >= 1.0f) break;
-        HAL_Delay(frame_delay);
+void Mono_BlitCols(int8_t r0, int8_t c0, const uint16_t *cols, uint8_t w, uint8_t h, Mono_Op op)
+{
+  // transpose the on-screen columns into row words, visiting set bits only
+  mono_row_t rows[16] = {0};
+  if (h > 16) h = 16;
+  int x0 = c0 < 0 ? -c0 : 0;
+  int x1 = (c0 + w > COLS) ? COLS - c0 : w;
+  for (int x = x0; x < x1; ++x) {
+    uint16_t bits = cols[x];
+    mono_row_t bit = (mono_row_t)(MONO_MSB >> (c0 + x));
+    while (bits) {
+      rows[__builtin_ctz(bits)] |= bit;
+      bits &= (uint16_t)(bits - 1u);
     }
+  }
 
-    // Final state = just the clock
-    Display_Clear();
-    Led_DrawClock(hh, mm, ss);
-    App_SetLastTick();
+  mono_row_t box = mono_span(c0, w);
+  for (uint8_t ry = 0; ry < h; ++ry) {
+    int rr = r0 + ry;
+    if (rr < 0 || rr >= ROWS) continue;
+    mono_apply(rr, rows[ry], box, op);
+  }
 }
 
-void Led_CurtainClose(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss)
+void Mono_CommitRect(int8_t r0, int8_t c0, uint8_t w, uint8_t h, uint8_t level)
 {
-    const int start_row = 7;
-    const int reveal_rows = 4;          // distance the lines move
-    const uint8_t line_level = BR_STEPS - 1;
-    const uint32_t frame_delay = 20;
-    const uint32_t start = HAL_GetTick();
+  if (BR_STEPS == 0) return;
+  if (level >= BR_STEPS) level = BR_STEPS - 1;
 
-    while (1) {
-        uint32_t now = HAL_GetTick();
-        uint32_t elapsed = now - start;
-        float t = (float)elapsed / (float)duration_ms;
-        if (t > 1.0f) t = 1.0f;
+  mono_row_t box = mono_span(c0, w);
+  for (uint8_t ry = 0; ry < h; ++ry) {
+    int rr = r0 + ry;
+    if (rr < 0 || rr >= ROWS) continue;
+    mono_row_t bits = mono[rr];
+    uint16_t   idx  = (uint16_t)rr * COLS;
+    for (uint8_t cx = 0; cx < w; ++cx) {
+      int cc = c0 + cx;
+      if (cc < 0 || cc >= COLS) continue;
+      fb_write(idx + cc, (bits & (MONO_MSB >> cc)) ? level : 0);
+    }
+    if (level == mono_shown_level)
+      mono_shown[rr] = (mono_row_t)((mono_shown[rr] & ~box) | (bits & box));
+    else
+      stale_rows |= ROW_BIT(rr);
+  }
+}
 
-        // Run easing backwards: 1 → 0
-        float eased = 1.0f - easeInExpo(1.0f - t);
+void Mono_Commit(uint8_t level)
+{
+  if (BR_STEPS == 0) return;
+  if (level >= BR_STEPS) level = BR_STEPS - 1;
 
-        // Offset goes from reveal_rows → 0
-        int offset = (int)((1.0f - eased) * reveal_rows);
+  face_valid = false;                    // the plane owns every cell from here
+  if (level != mono_shown_level) {       // every lit cell changes value
+    for (uint8_t r = 0; r < ROWS; ++r)
+      if (mono_shown[r]) stale_rows |= ROW_BIT(r);
+    mono_shown_level = level;
+  }
 
-        int top = start_row - offset;
-        int bottom = start_row + offset;
+  for (uint8_t r = 0; r < ROWS; ++r) {
+    mono_row_t bits = mono[r];
+    uint16_t   idx  = (uint16_t)r * COLS;
 
-        // Step 1: clear
-        Display_Clear();
+    if (stale_rows & ROW_BIT(r)) {
+      for (uint8_t c = 0; c < COLS; ++c)
+        fb_write(idx + c, (bits & (MONO_MSB >> c)) ? level : 0);
+    } else {
+      mono_row_t diff = bits ^ mono_shown[r];
+      while (diff) {                     // visit changed columns only
+        uint8_t c = (uint8_t)(__builtin_clz((uint32_t)diff) - (32 - MONO_BITS));
+        mono_row_t bit = (mono_row_t)(MONO_MSB >> c);
+        fb_write(idx + c, (bits & bit) ? level : 0);
+        diff &= (mono_row_t)~bit;
+      }
+    }
+    mono_shown[r] = bits;
+  }
+  stale_rows = 0;
+}
 
-        // Step 2: draw clock
-        Led_DrawClock(hh, mm, ss);
+uint16_t Display_PixelsTouched(void)
+{
+  uint16_t n = px_touched;
+  px_touched = 0;
+  return n;
+}
 
-        // Step 3: mask above top
-        if (top >= 0) {
-            Display_SetRegion(0, 0, COLS, top, 0);
-        }
-        // Step 4: mask below bottom
-        if (bottom + 1 < ROWS) {
-            Display_SetRegion(bottom + 1, 0, COLS, ROWS - (bottom + 1), 0);
-        }
+/* --------------- Curtain transitions (driven by anim.c) --------------- */
+#define CURTAIN_ROW         (ROWS / 2)
+#define CURTAIN_OPEN_ROWS   (ROWS / 2)   // reveal: lines travel to the edges
+#define CURTAIN_CLOSE_ROWS  4     // close: lines start 4 rows out
 
-        // Step 5: draw closing lines
-        if (top >= 0 && top < ROWS) {
-            for (int c = 0; c < COLS; c++)
-                Display_SetPixelRC(top, c, line_level);
-        }
-        if (bottom >= 0 && bottom < ROWS) {
-            for (int c = 0; c < COLS; c++)
-                Display_SetPixelRC(bottom, c, line_level);
-        }
+static uint8_t curtain_hh, curtain_mm, curtain_ss;
+static void (*curtain_then)(void);
 
-        if (t >= 1.0f) break;
-        HAL_Delay(frame_delay);
-    }
+// One curtain frame: clock masked outside [top, bottom], lines on both edges
+static void curtain_draw(int16_t offset)
+{
+    const uint8_t line_level = BR_STEPS - 1;
+    int top = CURTAIN_ROW - offset;
+    int bottom = CURTAIN_ROW + offset;
 
-    // Final = screen blank (curtains closed)
     Display_Clear();
+    Led_DrawClock(curtain_hh, curtain_mm, curtain_ss);
+
+    if (top >= 0) {
+        Display_SetRegion(0, 0, COLS, top, 0);
+    }
+    if (bottom + 1 < ROWS) {
+        Display_SetRegion(bottom + 1, 0, COLS, ROWS - (bottom + 1), 0);
+    }
+
+    if (top >= 0 && top < ROWS) {
+        for (int c = 0; c < COLS; c++)
+            Display_SetPixelRC(top, c, line_level);
+    }
+    if (bottom >= 0 && bottom < ROWS) {
+        for (int c = 0; c < COLS; c++)
+            Display_SetPixelRC(bottom, c, line_level);
+    }
 }
 
+static void curtain_reveal_done(void)
+{
+    // Final state = just the clock
+    Display_Clear();
+    Led_DrawClock(curtain_hh, curtain_mm, curtain_ss);
+    App_SetLastTick();
+}
 
-static void Led_DrawDigit3x5(uint8_t r0, uint8_t c0, int d, uint8_t level)
+static void curtain_close_done(void)
 {
-  if (d < 0 || d > 9) return;
-  for (uint8_t ry = 0; ry < HEX_H; ++ry) {
-    uint8_t row = HEX_3x5[d][ry];
-    for (uint8_t rx = 0; rx < HEX_W; ++rx) {
-      uint8_t bit = (row >> (HEX_W - 1 - rx)) & 1u;
-      uint8_t rr = r0 + ry, cc = c0 + rx;
-      if (rr < ROWS && cc < COLS)
-        Display_SetPixelRC(rr, cc, bit ? level : 0);
-    }
-  }
+    // Final = screen blank (curtains closed)
+    Display_Clear();
+    void (*then)(void) = curtain_then;
+    curtain_then = NULL;
+    if (then) then();
 }
 
-static void Led_DrawDigit4x3(uint8_t r0, uint8_t c0, int d, uint8_t level) {
-    if (d < 0 || d > 9) return;
-    for (uint8_t ry = 0; ry < 4; ++ry) {
-        uint8_t row = TINY_4x3[d][ry];
-        for (uint8_t rx = 0; rx < 3; ++rx) {
-            if ((row >> (2 - rx)) & 1u) {
-                Display_SetPixelRC(r0 + ry, c0 + rx, level);
-            }
-        }
-    }
+static const Anim_Track CURTAIN_REVEAL = {
+    .ease = ANIM_EASE_IN_EXPO, .from = 0, .to = CURTAIN_OPEN_ROWS,
+    .apply = curtain_draw, .done = curtain_reveal_done,
+};
+
+static const Anim_Track CURTAIN_CLOSE = {
+    .ease = ANIM_EASE_OUT_EXPO, .from = CURTAIN_CLOSE_ROWS, .to = 0,
+    .apply = curtain_draw, .done = curtain_close_done,
+};
+
+void Led_CurtainReveal(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss)
+{
+    curtain_hh = hh; curtain_mm = mm; curtain_ss = ss;
+    Anim_Stop(&CURTAIN_CLOSE);
+    Anim_Start(&CURTAIN_REVEAL, duration_ms);
 }
 
-static void Led_DrawColon(uint8_t r0, uint8_t c, bool on, uint8_t level)
+void Led_CurtainClose(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss,
+                      void (*then)(void))
 {
-  uint8_t rr1 = r0 + 1, rr2 = r0 + 3;
-  if (rr1 < ROWS) Display_SetPixelRC(rr1, c, on ? level : 0);
-  if (rr2 < ROWS) Display_SetPixelRC(rr2, c, on ? level : 0);
+    curtain_hh = hh; curtain_mm = mm; curtain_ss = ss;
+    curtain_then = then;
+    Anim_Stop(&CURTAIN_REVEAL);
+    Anim_Start(&CURTAIN_CLOSE, duration_ms);
 }
 
+
 void Led_AllOn(uint8_t level)
 {
     if (BR_STEPS == 0) return;
     if (level >= BR_STEPS) level = BR_STEPS - 1;
+    if (!level) { Display_Clear(); return; }
 
     __disable_irq();  // prevent scan ISR from seeing half-updated fb
-    for (uint16_t i = 0; i < N_PIXELS; ++i) {
-        fb[i] = level;
-        act_add(i);   // ensure each pixel is in the active list
+    for (uint16_t n = 0; n < LED_N_VALID; ++n) {
+        uint16_t idx = LED_VALID_PIX[n];
+        fb[idx] = level;
+        act[n] = LED_SCAN[idx];
+        pos_map[idx] = (int16_t)n;
     }
-    act_len = N_PIXELS;  // all pixels active
+    act_len = LED_N_VALID;  // every lit-capable pixel active
+    fb_load = (uint32_t)LED_N_VALID * LED_GAMMA_Q16[level];
+    stale_rows = ROW_SET_ALL;             // fb no longer matches the mono plane
+    face_valid = false;
+    scan_pos = 0;                         // new pass, so the current cap applies from the next slot
     __enable_irq();
 }
 
-void Led_DrawClock(uint8_t hh, uint8_t mm, uint8_t ss)
+// HH:MM (12 h, leading zero suppressed) into the mono plane
+static void mono_draw_hhmm(uint8_t hh, uint8_t mm, bool colon_on)
 {
-    Display_Clear();
     // Convert to 12h format
     uint8_t h = hh % 12;
     if (h == 0) h = 12;
@@ -292,25 +491,26 @@ void Led_DrawClock(uint8_t hh, uint8_t mm, uint8_t ss)
     uint8_t m10 = mm / 10;
     uint8_t m1  = mm % 10;
 
-    bool colon_on = ((ss & 1u) == 0);
-
     // shift if leading digit is 0
     int8_t shift = (h10 == 0) ? -(HEX_W + 1)/2 : 0;
 
     // Optional: suppress leading zero
-    if (h10 == 0) {
-        // clear that digit’s region
-        for (uint8_t ry = 0; ry < HEX_H; ++ry)
-            for (uint8_t rx = 0; rx < HEX_W; ++rx)
-                Display_SetPixelRC(ROW0 + ry, COL_D0 + rx + shift, 0);
-    } else {
-        Led_DrawDigit3x5(ROW0, COL_D0 + shift, h10, TIME_LEVEL);
+    if (h10 != 0)
+        Mono_Blit(ROW0, COL_D0 + shift, HEX_3x5[h10], HEX_W, HEX_H, MONO_OR);
+
+    Mono_Blit(ROW0, COL_D1 + shift, HEX_3x5[h1 ], HEX_W, HEX_H, MONO_OR);
+    Mono_Blit(ROW0, COL_D2 + shift, HEX_3x5[m10], HEX_W, HEX_H, MONO_OR);
+    Mono_Blit(ROW0, COL_D3 + shift, HEX_3x5[m1 ], HEX_W, HEX_H, MONO_OR);
+    if (colon_on) {
+        static const uint8_t COLON[4] = {0, 1, 0, 1};
+        Mono_Blit(ROW0, COL_COLON + shift, COLON, 1, 4, MONO_OR);
     }
+}
 
-    Led_DrawDigit3x5(ROW0, COL_D1 + shift, h1 , TIME_LEVEL);
-    Led_DrawDigit3x5(ROW0, COL_D2 + shift, m10, TIME_LEVEL);
-    Led_DrawDigit3x5(ROW0, COL_D3 + shift, m1 , TIME_LEVEL);
-    Led_DrawColon(ROW0, COL_COLON + shift, colon_on, TIME_LEVEL);
+void Led_DrawClock(uint8_t hh, uint8_t mm, uint8_t ss)
+{
+    Mono_Clear();
+    mono_draw_hhmm(hh, mm, (ss & 1u) == 0);
 
     // Draw seconds below HH:MM
     uint8_t s10 = ss / 10;
@@ -319,37 +519,183 @@ void Led_DrawClock(uint8_t hh, uint8_t mm, uint8_t ss)
     uint8_t sec_row = ROW0 + HEX_H + 1; // just below main digits
     uint8_t sec_col = (COLS - (3*2 + 1)) / 2; // center 2 tiny digits
 
-    Led_DrawDigit3x5(sec_row, sec_col, s10, TIME_LEVEL);
-    Led_DrawDigit3x5(sec_row, sec_col + 4, s1, TIME_LEVEL);
+    Mono_Blit(sec_row, sec_col,     HEX_3x5[s10], HEX_W, HEX_H, MONO_OR);
+    Mono_Blit(sec_row, sec_col + 4, HEX_3x5[s1 ], HEX_W, HEX_H, MONO_OR);
+
+    Mono_Commit(TIME_LEVEL);    // whole plane → fb, replaces Display_Clear()
 }
 
 
-void Led_Init(void)
+// master 0..255 → Q8 scale 0..256
+static inline uint16_t master_q8(uint8_t m)
 {
-    all_hi_z();
+  return (uint16_t)(((uint32_t)m * 256u + 127u) / 255u);
+}
+/* -------- Analog face --------
+   Hands come pre-rasterised from face_tables.h: one span of (pixel, level)
+   per hand and position, anti-aliased and clipped to VALID_MASK at build
+   time. A hand that moved is erased, then marks and hands are max-blended
+   back; cells that already hold their level return early in fb_write. */
+static void face_hand(uint8_t hand, uint8_t pos, bool erase)
+{
+    const FacePx *p   = &FACE_PX[FACE_OFS[hand * FACE_POS + pos]];
+    const FacePx *end = &FACE_PX[FACE_OFS[hand * FACE_POS + pos + 1u]];
+    for (; p < end; ++p) {
+        if (erase)                    fb_write(p->idx, 0);
+        else if (p->level > fb[p->idx]) fb_write(p->idx, p->level);
+    }
+}
+
+void Led_DrawAnalog(uint8_t hh, uint8_t mm, uint8_t ss)
+{
+    uint8_t pos[FACE_HANDS];
+    pos[FACE_HOUR]   = (uint8_t)((hh % 12u) * 5u + mm / 12u);
+    pos[FACE_MINUTE] = mm % FACE_POS;
+    pos[FACE_SECOND] = ss % FACE_POS;
 
-    for (uint16_t i = 0; i < N_PIXELS; ++i) {
-        fb[i] = 0;
-        pos_map[i] = -1;
+    if (!face_valid) {
+        Display_Clear();
+    } else {
+        bool moved = false;
+        for (uint8_t h = 0; h < FACE_HANDS; ++h) {
+            if (pos[h] == face_pos[h]) continue;
+            face_hand(h, face_pos[h], true);
+            moved = true;
+        }
+        if (!moved) return;
     }
-    act_len  = 0;
-    scan_pos = 0;
-    last_hi  = last_lo = -1;
 
-    // ---- build gamma LUT ----
+    for (uint8_t i = 0; i < FACE_MARKS_N; ++i)
+        if (fb[FACE_MARKS[i]] < FACE_MARK_LEVEL) fb_write(FACE_MARKS[i], FACE_MARK_LEVEL);
+    for (uint8_t h = 0; h < FACE_HANDS; ++h) {
+        face_hand(h, pos[h], false);
+        face_pos[h] = pos[h];
+    }
+    stale_rows = ROW_SET_ALL;           // written behind the mono plane
+    face_valid = true;
+}
+
+
+// gamma × master / 255, clamped to ARR: all the per-slot math, done once.
+// Entries keep the DITHER_BITS fraction; the slot path rounds per frame.
+static void build_ccr_table(uint8_t half, uint8_t master)
+{
+    uint16_t *tab = ccr_tab[half];
+    uint32_t arr = (uint32_t)__HAL_TIM_GET_AUTORELOAD(&htim2) << DITHER_BITS;
+    for (int i = 0; i < LUT_SIZE; i++) {
+        uint32_t ccr = ((uint32_t)gamma_lut[i] * master + 127u) / 255u;
+        tab[i] = (uint16_t)(ccr > arr ? arr : ccr);
+    }
+    ccr_master_q8[half] = master_q8(master);
+}
+
+void Led_Init(void)
+{
+    // fb, act and pos_map come up empty from .bss/.data; only the pins
+    // and the ARR-dependent gamma scale are left for runtime.
+    all_hi_z();
+
+    // ---- scale gamma LUT (curve generated by gen_led_tables.py) ----
     uint32_t arr = __HAL_TIM_GET_AUTORELOAD(&htim2);
     for (int i = 0; i < LUT_SIZE; i++) {
-        float norm = (float)i / 255.0f;
-        float corrected = powf(norm, GAMMA);
-        gamma_lut[i] = (uint16_t)(corrected * arr * 0.5f + 0.5f);
+        // Q16 × ARR × 0.5, rounded, with DITHER_BITS of fraction kept
+        gamma_lut[i] = (uint16_t)(((uint32_t)LED_GAMMA_Q16[i] * arr + (65536u >> DITHER_BITS))
+                                  >> (17 - DITHER_BITS));
     }
+
+    ccr_swap = false;
+    build_ccr_table(ccr_front, g_master);
+    Led_SetCurrentBudget(LED_CURRENT_BUDGET_UA);
+
+    // scan stats time the ISR with CYCCNT, which main() starts at reset
+    st_t0_ms  = HAL_GetTick();
+    st_t0_cyc = Profile_Cycles();
 }
 
 void Led_SetGlobalBrightness(uint8_t level)
 {
-  if (BR_STEPS == 0) { g_master = 0; return; }
-  if (level >= BR_STEPS) level = BR_STEPS - 1;
+  if (BR_STEPS == 0) level = 0;
+  else if (level >= BR_STEPS) level = BR_STEPS - 1;
   g_master = level;
+
+  fade_step_slots = FADE_HOLD;            // a running fade stops stepping
+  Led_FadePoll();                         // a finished fade still gets its hook
+  fade_step_slots = FADE_HOLD;            // the hook may have started another fade
+  fade_done = NULL;                       // a fade still running is cancelled
+  ccr_swap = false;                       // ISR keeps the front table meanwhile
+  build_ccr_table(ccr_front ^ 1u, level);
+  ccr_swap = true;                        // flip at next frame start, ends any fade
+}
+
+uint8_t Led_GetGlobalBrightness(void)
+{
+  return g_master;
+}
+
+void Led_SetCurrentBudget(uint32_t budget_ua)
+{
+  // uA → mean duty in Q16 of LED_PIXEL_UA; a budget above full drive never limits
+  uint32_t d = (uint32_t)(((uint64_t)budget_ua << 16) / LED_PIXEL_UA);
+  if (budget_ua && !d) d = 1u;            // tiny budget: cap hard rather than not at all
+  lim_duty = d > 0xFFFFu ? 0u : d;
+}
+
+uint32_t Led_CurrentEstimate_uA(void)
+{
+  return ((uint32_t)led_duty * LED_PIXEL_UA + 0x8000u) >> 16;
+}
+
+bool Led_CurrentLimited(void)
+{
+  return lim_q8 < 256u;
+}
+
+void Led_FadeTo(uint8_t level, uint16_t duration_ms, Anim_Ease ease, void (*done)(void))
+{
+  if (level >= BR_STEPS) level = BR_STEPS - 1;
+
+  fade_step_slots = FADE_HOLD;            // ISR holds its current level from here
+  Led_FadePoll();                         // finished but unpolled: run its hook before re-arming
+  fade_step_slots = FADE_HOLD;            // the hook may have started another fade
+  ccr_swap = false;
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint16_t from = fade_on ? fade_scale : master_q8(g_master);
+  fade_scale = from;
+  fade_on = true;                         // same level, now via the scale path
+  __set_PRIMASK(primask);
+
+  int32_t span = (int32_t)master_q8(level) - from;
+  for (uint8_t i = 0; i < FADE_STEPS; ++i) {
+    uint16_t t = (uint16_t)(((uint32_t)(i + 1) * 65535u) / FADE_STEPS);
+    fade_tab[i] = (uint16_t)(from + (span * (int32_t)Anim_Ease16(ease, t)) / 65535);
+  }
+  build_ccr_table(ccr_front ^ 1u, level);
+  g_master  = level;
+  fade_done = done;
+
+  // slot rate = SYSCLK / (ARR + 1); TIM2 runs at PSC 0
+  uint32_t slot_hz = SystemCoreClock / (__HAL_TIM_GET_AUTORELOAD(&htim2) + 1u);
+  uint32_t steps   = ((uint32_t)duration_ms * slot_hz) / (1000u * FADE_STEPS);
+
+  fade_i   = 0;
+  fade_arm = true;                        // count from the next frame start
+  fade_step_slots = steps ? steps : 1u;
+}
+
+bool Led_FadeBusy(void)
+{
+  return fade_on || fade_end;
+}
+
+void Led_FadePoll(void)
+{
+  if (!fade_end) return;
+  fade_end = false;
+  void (*then)(void) = fade_done;
+  fade_done = NULL;
+  if (then) then();
 }
 
 // Fast powers of 10 (for 32-bit ints)
@@ -429,21 +775,21 @@ void draw_hex_byte(uint8_t r0, uint8_t c0, uint8_t byte, uint8_t level)
 void draw_hex_nibble(uint8_t r0, uint8_t c0, uint8_t nib, uint8_t level)
 {
   nib &= 0x0F;
-  for (uint8_t ry = 0; ry < HEX_H; ++ry) {
-    uint8_t row = HEX_3x5[nib][ry];
-    for (uint8_t rx = 0; rx < HEX_W; ++rx) {
-      uint8_t bit = (row >> (HEX_W - 1 - rx)) & 1u;
-      uint8_t rr = r0 + ry, cc = c0 + rx;
-      if (rr < ROWS && cc < COLS)
-        Display_SetPixelRC(rr, cc, bit ? level : 0);
-    }
-  }
+  Mono_Blit(r0, c0, HEX_3x5[nib], HEX_W, HEX_H, MONO_COPY);
+  Mono_CommitRect(r0, c0, HEX_W, HEX_H, level);
 }
 
 void Display_Clear(void)
 {
   // Clear framebuffer
   for (uint16_t i = 0; i < N_PIXELS; ++i) fb[i] = 0;
+  px_touched += act_len;
+  fb_load = 0;
+  face_valid = false;
+
+  // fb is all zero now, which an empty shown-plane describes at any level
+  for (uint8_t r = 0; r < ROWS; ++r) mono_shown[r] = 0;
+  stale_rows = 0;
 
   // Quickly empty active list (minimal IRQ-off time)
   __disable_irq();
@@ -467,12 +813,19 @@ void Display_SetPixelRC(uint8_t r, uint8_t c, uint8_t level)
   if (BR_STEPS == 0) return;
   if (level >= BR_STEPS) level = BR_STEPS - 1;
 
-  uint8_t old = fb[idx];
-  fb[idx] = level;
+  fb_write(idx, level);
+  stale_rows |= ROW_BIT(r);
+}
 
-  if (!old && level)        act_add(idx);
-  else if (old && !level)   act_remove(idx);
-  // else: brightness changed but remains active; leave position stable
+// Caller has clipped r, c to the board; the brighter of fb and level wins
+void Display_MaxPixel(uint8_t r, uint8_t c, uint8_t level)
+{
+  uint16_t idx = (uint16_t)r * COLS + c;
+  if (level <= fb[idx]) return;
+
+  fb_write(idx, level);
+  stale_rows |= ROW_BIT(r);
+  face_valid = false;
 }
 
 void led_set_pixel(uint8_t r, uint8_t c, uint8_t level) {
@@ -489,11 +842,8 @@ void Display_SetRegion(uint8_t r0, uint8_t c0, uint8_t w, uint8_t h, uint8_t lev
       uint8_t rr = (uint8_t)(r0 + r);
       uint8_t cc = (uint8_t)(c0 + c);
       if (rr < ROWS && cc < COLS) {
-        uint16_t idx = (uint16_t)rr * COLS + cc;
-        uint8_t old = fb[idx];
-        fb[idx] = level;
-        if (!old && level)        act_add(idx);
-        else if (old && !level)   act_remove(idx);
+        fb_write((uint16_t)rr * COLS + cc, level);
+        stale_rows |= ROW_BIT(rr);
       }
     }
   }
@@ -505,38 +855,318 @@ void Display_SetRegion(uint8_t r0, uint8_t c0, uint8_t w, uint8_t h, uint8_t lev
    - HAL_TIM_OC_DelayElapsedCallback(TIM2, CH1) → Led_ScanSlotEnd()
 */
 
-void Led_ScanSlotStart(void)
+// Advance a running fade by the slots elapsed since the last frame start
+static inline __attribute__((always_inline)) void fade_step(void)
 {
-    uint16_t len = act_len;
-    if (len == 0) { release_last(); return; }
+    if (fade_arm) { fade_arm = false; fade_slots = 0; }
+    while (fade_slots >= fade_step_slots) {
+        fade_slots -= fade_step_slots;
+        if (fade_i >= FADE_STEPS) {        // target held for a step: back to the table
+            ccr_front ^= 1u;
+            fade_on  = false;
+            fade_end = true;
+            return;
+        }
+        fade_scale = fade_tab[fade_i++];
+    }
+}
 
+// Mean duty of the frame about to start and the CCR scale that keeps it
+// under lim_duty. Q16 gamma × Q8 master, halved for the ARR/2 ON-time cap.
+static inline __attribute__((always_inline)) void limit_update(uint16_t len)
+{
+    uint16_t scale = fade_on ? fade_scale : ccr_master_q8[ccr_front];
+    uint32_t duty  = len ? ((fb_load / len) * scale) >> 9 : 0u;
+    uint32_t cap   = lim_duty;
+    if (cap && duty > cap) {
+        lim_q8   = (uint16_t)((cap << 8) / duty);
+        led_duty = (uint16_t)cap;
+    } else {
+        lim_q8   = 256u;
+        led_duty = (uint16_t)duty;
+    }
+}
+
+static inline __attribute__((always_inline)) void frame_start(uint16_t len)
+{
+    dither_frame++;
+    if (ccr_swap) {                        // adopt new table, drop any fade
+        ccr_front ^= 1u;
+        ccr_swap = false;
+        fade_on  = false;
+    } else if (fade_on) {
+        fade_step();
+    }
+    limit_update(len);                     // fb changes are capped from the next frame on
+}
+
+static inline __attribute__((always_inline)) void scan_slot_start(void)
+{
+    uint16_t len = act_len;
     uint16_t pos = scan_pos;
     if (pos >= len) pos = 0;
 
+    if (fade_on) fade_slots++;
+    if (pos == 0) frame_start(len);        // frame boundary: tables, fades and the cap move here only
+    if (len == 0) { release_last(); return; }
+
+    if (pos == 0) st_frames++;
+
     ScanEntry e = act[pos];
     scan_pos = (uint16_t)(pos + 1);
 
     uint8_t level = fb[e.idx];
     if (!level) { release_last(); return; }
 
-    // Apply gamma from LUT + global brightness
-    uint16_t base = gamma_lut[level];
-    uint32_t arr  = __HAL_TIM_GET_AUTORELOAD(&htim2);
-    uint32_t ccr  = ((uint32_t)base * g_master) / 255u;
-    if (ccr > arr) ccr = arr;
+#ifdef LED_BENCH
+    if (!first_pixel_cyc) first_pixel_cyc = Profile_Cycles();
+#endif
 
+    // gamma + global brightness + ARR clamp, precomputed; one multiply while fading
+    uint16_t ccr = fade_on ? (uint16_t)(((uint32_t)gamma_lut[level] * fade_scale) >> 8)
+                           : ccr_tab[ccr_front][level];
+    uint16_t lim = lim_q8;
+    if (lim < 256u) ccr = (uint16_t)(((uint32_t)ccr * lim) >> 8);   // over the current budget
+    ccr = (uint16_t)((ccr + DITHER_SEQ[(dither_frame + e.idx) & (DITHER_N - 1u)]) >> DITHER_BITS);
     __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, ccr);
-    drive_pair(e.hi, e.lo);
+    drive_pixel(e.idx);
 }
 
 
-void Led_ScanSlotEnd(void)
+// The slot start with its cycle and latency stats, shared by the RAM handler
+// and the flash twin so the A/B bench compares like with like
+static inline __attribute__((always_inline)) void scan_slot_start_timed(void)
+{
+    uint16_t lat = (uint16_t)__HAL_TIM_GET_COUNTER(&htim2);
+    uint32_t t0  = DWT->CYCCNT;
+
+    scan_slot_start();
+
+    uint16_t cyc = (uint16_t)(DWT->CYCCNT - t0);
+    st_slots++;
+    st_cyc_sum += cyc;
+    if (cyc < st_cyc_min) st_cyc_min = cyc;
+    if (cyc > st_cyc_max) st_cyc_max = cyc;
+    if (lat > st_lat_max) st_lat_max = lat;
+}
+
+RAMFUNC void Led_ScanSlotStart(void)
+{
+    scan_slot_start_timed();
+}
+
+RAMFUNC void Led_ScanSlotEnd(void)
 {
   // End of ON-time for current slot: tri-state active pins
   release_last();
 }
 
 
+/* -------------- Ambient scan (LPTIM1) --------------
+   One LSE tick of ON time per lit slot; level and master are ignored since
+   the mono clock is single-level anyway. Slots past act_len stay dark so
+   the frame is AMBIENT_FRAME_SLOTS long however few digits are lit. */
+RAMFUNC void Led_AmbientSlotStart(void)
+{
+    uint16_t len   = act_len;
+    uint16_t frame = (len > AMBIENT_FRAME_SLOTS) ? len : AMBIENT_FRAME_SLOTS;
+    uint16_t pos   = scan_pos;
+    if (pos >= frame) pos = 0;
+    scan_pos = (uint16_t)(pos + 1);
+
+    if (pos >= len) { release_last(); return; }    // padding slot
+    ScanEntry e = act[pos];
+    drive_pixel(e.idx);
+}
+
+void Led_AmbientUpdate(uint8_t hh, uint8_t mm)
+{
+    Mono_Clear();
+    mono_draw_hhmm(hh, mm, true);       // steady colon, no seconds
+    Mono_Commit(TIME_LEVEL);
+}
+
+void Led_AmbientEnter(uint8_t hh, uint8_t mm)
+{
+    if (ambient) return;
+
+    HAL_TIM_OC_Stop_IT(&htim2, TIM_CHANNEL_1);
+    HAL_TIM_Base_Stop_IT(&htim2);
+    release_last();
+
+    ambient  = true;
+    scan_pos = 0;
+    Led_AmbientUpdate(hh, mm);
+
+    if (HAL_LPTIM_PWM_Start_IT(&hlptim1, AMBIENT_SLOT_TICKS - 1, AMBIENT_ON_TICKS - 1) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
+void Led_AmbientLeave(void)
+{
+    if (!ambient) return;
+
+    HAL_LPTIM_PWM_Stop_IT(&hlptim1);
+    release_last();
+    ambient = false;
+    Display_Clear();
+
+    HAL_TIM_Base_Start_IT(&htim2);
+    HAL_TIM_OC_Start_IT(&htim2, TIM_CHANNEL_1);
+}
+
+bool Led_AmbientActive(void)
+{
+    return ambient;
+}
+
+#ifdef LED_BENCH
+/* Flash-resident twin of Led_ScanSlotStart, built only for the A/B run. */
+static __attribute__((noinline)) void scan_slot_start_flash(void)
+{
+    scan_slot_start_timed();
+}
+
+void Led_BenchScan(uint32_t iters, uint32_t *ram_cyc, uint32_t *flash_cyc)
+{
+    if (iters == 0) iters = 1;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();                       // keep TIM2/SysTick out of the window
+
+    uint32_t t0 = Profile_Cycles();
+    for (uint32_t i = 0; i < iters; ++i) Led_ScanSlotStart();
+    uint32_t t1 = Profile_Cycles();
+    for (uint32_t i = 0; i < iters; ++i) scan_slot_start_flash();
+    uint32_t t2 = Profile_Cycles();
+
+    release_last();
+    __set_PRIMASK(primask);
+
+    *ram_cyc   = (t1 - t0) / iters;
+    *flash_cyc = (t2 - t1) / iters;
+}
+
+uint32_t Led_BenchFirstPixel(void)
+{
+    return first_pixel_cyc;
+}
+
+/* The code the build-time tables and ccr_tab replaced lives on here only,
+   so a single bench run prints both sides of each change. */
+static volatile uint32_t bench_sink;
+
+void Led_BenchGamma(uint32_t *powf_cyc, uint32_t *table_cyc)
+{
+    uint32_t arr = __HAL_TIM_GET_AUTORELOAD(&htim2);
+
+    uint32_t t0 = Profile_Cycles();
+    for (int i = 0; i < LUT_SIZE; i++) {
+        float norm = (float)i / 255.0f;
+        bench_sink = (uint16_t)(powf(norm, 2.8f) * arr * 0.5f + 0.5f);
+    }
+    uint32_t t1 = Profile_Cycles();
+    for (int i = 0; i < LUT_SIZE; i++) {
+        bench_sink = (uint16_t)(((uint32_t)LED_GAMMA_Q16[i] * arr + (65536u >> DITHER_BITS))
+                                >> (17 - DITHER_BITS));
+    }
+    uint32_t t2 = Profile_Cycles();
+
+    *powf_cyc  = t1 - t0;
+    *table_cyc = t2 - t1;
+}
+
+void Led_BenchCcr(uint32_t iters, uint32_t *div_cyc, uint32_t *lut_cyc)
+{
+    if (iters == 0) iters = 1;
+    volatile uint8_t master = g_master;    // the ISR reloads the global every slot
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t t0 = Profile_Cycles();
+    for (uint32_t i = 0; i < iters; ++i) {
+        uint16_t base = gamma_lut[(uint8_t)i];
+        uint32_t arr  = __HAL_TIM_GET_AUTORELOAD(&htim2);
+        uint32_t ccr  = ((uint32_t)base * master) / 255u;
+        if (ccr > arr) ccr = arr;
+        bench_sink = ccr;
+    }
+    uint32_t t1 = Profile_Cycles();
+    for (uint32_t i = 0; i < iters; ++i) {
+        bench_sink = ccr_tab[ccr_front][(uint8_t)i];
+    }
+    uint32_t t2 = Profile_Cycles();
+
+    __set_PRIMASK(primask);
+
+    *div_cyc = (t1 - t0) / iters;
+    *lut_cyc = (t2 - t1) / iters;
+}
+#endif
+
+/* -------------- Scan timing readout -------------- */
+void Led_ScanStatsRead(Led_ScanStats *out)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t frames = st_frames,  slots = st_slots, sum = st_cyc_sum;
+    uint16_t cmin   = st_cyc_min, cmax  = st_cyc_max, lat = st_lat_max;
+    uint16_t len    = act_len;
+    st_frames = 0; st_slots = 0; st_cyc_sum = 0;
+    st_cyc_min = 0xFFFF; st_cyc_max = 0; st_lat_max = 0;
+    __set_PRIMASK(primask);
+
+    uint32_t now_ms  = HAL_GetTick();
+    uint32_t now_cyc = Profile_Cycles();
+    uint32_t dt_ms   = now_ms - st_t0_ms;
+    uint32_t dt_cyc  = now_cyc - st_t0_cyc;
+    st_t0_ms  = now_ms;
+    st_t0_cyc = now_cyc;
+
+    out->fps     = (uint16_t)(dt_ms ? (frames * 1000u + dt_ms / 2) / dt_ms : 0);
+    out->active  = len;
+    out->slots   = slots;
+    out->cyc_min = slots ? cmin : 0;
+    out->cyc_max = cmax;
+    out->cyc_avg = (uint16_t)(slots ? sum / slots : 0);
+    out->lat_max = lat;
+    // CYCCNT wraps after 2^32 / 16 MHz ≈ 268 s; fine for once-a-second reads
+    out->load_pm = (uint16_t)(dt_cyc ? ((uint64_t)sum * 1000u) / dt_cyc : 0);
+    out->led_ua  = (uint16_t)Led_CurrentEstimate_uA();
+}
+
+void Led_ScanStatsDump(const Led_ScanStats *s)
+{
+    printf("scan: %u fps, %u px, %lu slots, cyc %u/%u/%u, lat %u, load %u.%u%%, led %u uA%s\r\n",
+           s->fps, s->active, (unsigned long)s->slots,
+           s->cyc_min, s->cyc_avg, s->cyc_max, s->lat_max,
+           s->load_pm / 10u, s->load_pm % 10u,
+           s->led_ua, Led_CurrentLimited() ? " (capped)" : "");
+}
+
+// One value per page, centred, with a dot under it marking which page it is
+#define STATS_DOT_C0  ((COLS - 2 * (LED_STATS_PAGES - 1)) / 2)   // first page's dot
+_Static_assert(2 * (LED_STATS_PAGES - 1) < COLS, "stats page dots do not fit the width");
+
+void Led_DrawScanStats(const Led_ScanStats *s, uint8_t page, uint8_t level)
+{
+    uint32_t v;
+    switch (page % LED_STATS_PAGES) {
+        case 0:  v = s->fps;     break;
+        case 1:  v = s->cyc_avg; break;
+        case 2:  v = s->lat_max; break;
+        case 3:  v = s->load_pm; break;
+        default: v = s->led_ua;  break;
+    }
+    if (v > 9999u) v = 9999u;           // four 3x5 digits fill the width
+
+    Display_Clear();
+    draw_int_center((int32_t)v, level);
+    Display_SetPixelRC((ROWS + HEX_H) / 2 + 2, STATS_DOT_C0 + 2 * (page % LED_STATS_PAGES), level);
+}
+
 void Led_Suspend(void) {  // public wrapper
   // release_last() and all_hi_z() exist in your file already
   extern void Led_ScanSlotEnd(void); // if release_last is static-only
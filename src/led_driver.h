@@ -1,13 +1,34 @@
 #pragma once
 #include "main.h"
+#include "led_tables.h"   // board geometry, pins and scan tables (gen_led_tables.py)
+#include "anim.h"
+#include <stdbool.h>
 
 void Led_Init(void);
 void Led_ScanSlotStart(void);
 void Led_ScanSlotEnd(void);
 void Led_SetGlobalBrightness(uint8_t level);
+uint8_t Led_GetGlobalBrightness(void);   // target level, also while fading
+// Frame-synchronised ramp of the global brightness, stepped by the scan ISR.
+// A new fade or Led_SetGlobalBrightness first runs the hook of a fade that
+// already finished; a fade still running is superseded and its hook dropped.
+void Led_FadeTo(uint8_t level, uint16_t duration_ms, Anim_Ease ease, void (*done)(void));
+bool Led_FadeBusy(void);
+void Led_FadePoll(void);                 // runs the done hook; call from the main loop
+
+// LED current estimate and limit. Each slot drives one LED at LED_PIXEL_UA
+// for its ON time, so the draw is the mean gamma duty of the lit pixels ×
+// master. Over budget the scan ISR scales the CCR from the next frame on.
+#define LED_PIXEL_UA           5000u   // one LED through two pin drivers (bench guess)
+#define LED_CURRENT_BUDGET_UA  1500u   // default cap; full white at master 255 is ~2500 uA
+void Led_SetCurrentBudget(uint32_t budget_ua);   // 0 = no limit
+uint32_t Led_CurrentEstimate_uA(void);           // running frame, after the cap
+bool Led_CurrentLimited(void);                   // cap active for the running frame
+
 void Display_Clear(void);
 void Display_SetPixelRC(uint8_t r, uint8_t c, uint8_t level);   // 0..BR_LEVELS
 void Display_SetRegion(uint8_t r0, uint8_t c0, uint8_t w, uint8_t h, uint8_t level);
+void Display_MaxPixel(uint8_t r, uint8_t c, uint8_t level);     // no clipping; keeps the brighter
 void Led_Suspend(void);   // all matrix pins Hi-Z, release any active pair
 void Led_Resume(void);    // nothing to do now, placeholder for future
 void draw_byte_center(uint8_t byte, uint8_t level);
@@ -15,76 +36,50 @@ void draw_hex_nibble(uint8_t r0, uint8_t c0, uint8_t nib, uint8_t level);
 void draw_digit(uint8_t r0, uint8_t c0, uint8_t digit, uint8_t level);
 void Led_AllOn(uint8_t level);
 
-#define N_PINS     16
-#define BR_LEVELS  256
-#define BR_STEPS   256
+// 1-bit plane (one uint16_t per row) for glyph work; committed to fb at one level
+typedef enum { MONO_OR, MONO_ANDNOT, MONO_XOR, MONO_COPY } Mono_Op;
+void Mono_Clear(void);
+void Mono_Blit(int8_t r0, int8_t c0, const uint8_t *rows, uint8_t w, uint8_t h, Mono_Op op); // rows NULL = solid box
+void Mono_BlitCols(int8_t r0, int8_t c0, const uint16_t *cols, uint8_t w, uint8_t h, Mono_Op op); // bit r of cols[x] = row r0+r, h <= 16
+void Mono_CommitRect(int8_t r0, int8_t c0, uint8_t w, uint8_t h, uint8_t level);
+void Mono_Commit(uint8_t level);          // incremental: only cells that changed since last commit
+uint16_t Display_PixelsTouched(void);     // fb cells changed since last call (read & reset)
 
+// Scan timing, accumulated by the TIM2 hooks since the previous read
 typedef struct {
-  GPIO_TypeDef *port;
-  uint8_t pos;           // pin number 0..15
-  uint16_t pinmask;      // (1 << pos)
-} Pin;
-
-static const Pin pins[N_PINS] = {
-  {GPIOB,  1, GPIO_PIN_1},
-  {GPIOB,  3, GPIO_PIN_3},
-  {GPIOA,  8, GPIO_PIN_8},
-  {GPIOB,  5, GPIO_PIN_5},
-  {GPIOB,  0, GPIO_PIN_0},
-  {GPIOA,  3, GPIO_PIN_3},
-  {GPIOB,  4, GPIO_PIN_4},
-  {GPIOA,  2, GPIO_PIN_2},
-  {GPIOA, 12, GPIO_PIN_12},
-  {GPIOA,  1, GPIO_PIN_1},
-  {GPIOA, 11, GPIO_PIN_11},
-  {GPIOB,  6, GPIO_PIN_6},
-  {GPIOA,  9, GPIO_PIN_9},
-  {GPIOA, 15, GPIO_PIN_15},
-  {GPIOA, 10, GPIO_PIN_10},
-  {GPIOB,  7, GPIO_PIN_7},
-};
+  uint16_t fps;                       // full passes over the active list per second
+  uint16_t active;                    // pixels in the active list at read time
+  uint32_t slots;                     // Led_ScanSlotStart calls in the window
+  uint16_t cyc_min, cyc_avg, cyc_max; // DWT cycles inside Led_ScanSlotStart
+  uint16_t lat_max;                   // worst TIM2 count at slot start (ticks after update)
+  uint16_t load_pm;                   // slot-start share of the CPU, per mille
+  uint16_t led_ua;                    // Led_CurrentEstimate_uA() at read time
+} Led_ScanStats;
+#define LED_STATS_PAGES 5             // fps, avg cycles, max latency, load, LED uA
+void Led_ScanStatsRead(Led_ScanStats *out);    // snapshot and restart the window
+void Led_ScanStatsDump(const Led_ScanStats *s); // one line over SWO
+void Led_DrawScanStats(const Led_ScanStats *s, uint8_t page, uint8_t level);
+void draw_int_center(int32_t value, uint8_t level);
 
-#define ROWS     15
-#define COLS     15
-#define N_PIXELS (ROWS*COLS)
+// Ambient display: HH:MM only, LPTIM1 on LSE (32.768 kHz) clocks the slots
+// while the core runs at 4 MHz. Padding slots keep the frame rate fixed.
+#define AMBIENT_SLOT_TICKS   8    // 244 us per slot, 4096 slots/s
+#define AMBIENT_ON_TICKS     1    // 30.5 us ON per lit slot
+#define AMBIENT_FRAME_SLOTS  64   // 64 Hz frames while act_len <= 64
+void Led_AmbientEnter(uint8_t hh, uint8_t mm); // TIM2 off, LPTIM1 on; call before the clock drops
+void Led_AmbientUpdate(uint8_t hh, uint8_t mm);
+void Led_AmbientLeave(void);                   // LPTIM1 off, TIM2 back; call after the clock is restored
+void Led_AmbientSlotStart(void);               // LPTIM1 autoreload-match hook
+bool Led_AmbientActive(void);
+#ifdef LED_BENCH
+void Led_BenchScan(uint32_t iters, uint32_t *ram_cyc, uint32_t *flash_cyc); // avg cycles per slot
+uint32_t Led_BenchFirstPixel(void);   // CYCCNT at first lit slot (counter started in main)
+void Led_BenchGamma(uint32_t *powf_cyc, uint32_t *table_cyc);            // boot gamma build, old vs new
+void Led_BenchCcr(uint32_t iters, uint32_t *div_cyc, uint32_t *lut_cyc); // per-slot CCR math, old vs new
+#endif
 
-typedef struct { uint8_t hi, lo; } CP_Step;
-
-static const CP_Step STEPS[N_PIXELS] = {
-  /* r00 */ {0,0}, {0,0}, {0,0}, {0,0}, {2,4}, {6,4}, {4,6}, {8,6}, {6,8}, {10,8}, {8,10}, {0,0}, {0,0}, {0,0}, {0,0},
-  /* r01 */ {0,0}, {0,0}, {4,0}, {0,4}, {6,2}, {2,6}, {8,4}, {4,8}, {10,6}, {6,10}, {12,8}, {8,12}, {14,10}, {0,0}, {0,0},
-  /* r02 */ {0,0}, {4,1}, {1,4}, {6,0}, {0,6}, {8,2}, {2,8}, {10,4}, {4,10}, {12,6}, {6,12}, {14,8}, {8,14}, {15,10}, {0,0},
-  /* r03 */ {0,0}, {3,4}, {6,1}, {1,6}, {8,0}, {0,8}, {10,2}, {2,10}, {12,4}, {4,12}, {14,6}, {6,14}, {15,8}, {8,15}, {0,0},
-  /* r04 */ {5,4}, {6,3}, {3,6}, {8,1}, {1,8}, {10,0}, {0,10}, {12,2}, {2,12}, {14,4}, {4,14}, {15,6}, {6,15}, {13,8}, {8,13},
-  /* r05 */ {6,5}, {5,6}, {8,3}, {3,8}, {10,1}, {1,10}, {12,0}, {0,12}, {14,2}, {2,14}, {15,4}, {4,15}, {13,6}, {6,13}, {11,8},
-  /* r06 */ {7,6}, {8,5}, {5,8}, {10,3}, {3,10}, {12,1}, {1,12}, {14,0}, {0,14}, {15,2}, {2,15}, {13,4}, {4,13}, {11,6}, {6,11},
-  /* r07 */ {8,7}, {7,8}, {10,5}, {5,10}, {12,3}, {3,12}, {14,1}, {1,14}, {15,0}, {0,15}, {13,2}, {2,13}, {11,4}, {4,11}, {9,6},
-  /* r08 */ {9,8}, {10,7}, {7,10}, {12,5}, {5,12}, {14,3}, {3,14}, {15,1}, {1,15}, {13,0}, {0,13}, {11,2}, {2,11}, {9,4}, {4,9},
-  /* r09 */ {10,9}, {9,10}, {12,7}, {7,12}, {14,5}, {5,14}, {15,3}, {3,15}, {13,1}, {1,13}, {11,0}, {0,11}, {9,2}, {2,9}, {7,4},
-  /* r10 */ {11,10}, {12,9}, {9,12}, {14,7}, {7,14}, {15,5}, {5,15}, {13,3}, {3,13}, {11,1}, {1,11}, {9,0}, {0,9}, {7,2}, {2,7},
-  /* r11 */ {0,0}, {11,12}, {14,9}, {9,14}, {15,7}, {7,15}, {13,5}, {5,13}, {11,3}, {3,11}, {9,1}, {1,9}, {7,0}, {0,7}, {0,0},
-  /* r12 */ {0,0}, {14,11}, {11,14}, {15,9}, {9,15}, {13,7}, {7,13}, {11,5}, {5,11}, {9,3}, {3,9}, {7,1}, {1,7}, {5,0}, {0,0},
-  /* r13 */ {0,0}, {0,0}, {15,11}, {11,15}, {13,9}, {9,13}, {11,7}, {7,11}, {9,5}, {5,9}, {7,3}, {3,7}, {5,1}, {0,0}, {0,0},
-  /* r14 */ {0,0}, {0,0}, {0,0}, {0,0}, {11,13}, {11,9}, {9,11}, {9,7}, {7,9}, {7,5}, {5,7}, {0,0}, {0,0}, {0,0}, {0,0},
-};
-
-static const uint8_t VALID_MASK[N_PIXELS] = {
-  /* r0  */ 0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,
-  /* r1  */ 0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
-  /* r2  */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
-  /* r3  */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
-  /* r4  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r5  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r6  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r7  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r8  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r9  */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r10 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-  /* r11 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
-  /* r12 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
-  /* r13 */ 0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
-  /* r14 */ 0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,
-};
+#define BR_LEVELS  256
+#define BR_STEPS   256
 
 #define HEX_W 3
 #define HEX_H 5
@@ -124,4 +119,9 @@ static const uint8_t TINY_4x3[10][4] = {
 
 
 void draw_hex_byte(uint8_t r0, uint8_t c0, uint8_t byte, uint8_t level);
-void Led_CurtainReveal(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss);
\ No newline at end of file
+void Led_DrawClock(uint8_t hh, uint8_t mm, uint8_t ss);
+void Led_DrawAnalog(uint8_t hh, uint8_t mm, uint8_t ss);   // only moved hands are redrawn
+// Curtains run on the anim engine: these return at once, App_Loop ticks them.
+void Led_CurtainReveal(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss);
+void Led_CurtainClose(uint16_t duration_ms, uint8_t hh, uint8_t mm, uint8_t ss,
+                      void (*then)(void));   // then() runs once the screen is blank
\ No newline at end of file
@@ -0,0 +1,377 @@
+// Generated by gen_led_tables.py from boards/round15.json - do not edit.
+#pragma once
+#include "main.h"
+
+#define LED_BOARD    "round15"
+#define ROWS         15
+#define COLS         15
+#define N_PIXELS     (ROWS*COLS)
+#define N_PINS       16
+#define LED_N_PORTS  2
+#define LED_NO_PAIR  0xFF   // ScanEntry.hi for pixels that cannot light
+#define LED_N_VALID  193
+
+typedef struct {
+  GPIO_TypeDef *port;
+  uint8_t pos;           // pin number 0..15
+  uint16_t pinmask;      // (1 << pos)
+} Pin;
+
+static const Pin pins[N_PINS] = {
+  {GPIOB,  1, GPIO_PIN_1},
+  {GPIOB,  3, GPIO_PIN_3},
+  {GPIOA,  8, GPIO_PIN_8},
+  {GPIOB,  5, GPIO_PIN_5},
+  {GPIOB,  0, GPIO_PIN_0},
+  {GPIOA,  3, GPIO_PIN_3},
+  {GPIOB,  4, GPIO_PIN_4},
+  {GPIOA,  2, GPIO_PIN_2},
+  {GPIOA, 12, GPIO_PIN_12},
+  {GPIOA,  1, GPIO_PIN_1},
+  {GPIOA, 11, GPIO_PIN_11},
+  {GPIOB,  6, GPIO_PIN_6},
+  {GPIOA,  9, GPIO_PIN_9},
+  {GPIOA, 15, GPIO_PIN_15},
+  {GPIOA, 10, GPIO_PIN_10},
+  {GPIOB,  7, GPIO_PIN_7},
+};
+
+typedef struct { uint8_t hi, lo; } CP_Step;
+typedef struct { uint8_t hi, lo; uint16_t idx; } ScanEntry;
+
+// anode/cathode pin index per pixel; {0,0} where VALID_MASK is 0
+static const CP_Step STEPS[N_PIXELS] = {
+  /* r00 */ {0,0}, {0,0}, {0,0}, {0,0}, {2,4}, {6,4}, {4,6}, {8,6}, {6,8}, {10,8}, {8,10}, {0,0}, {0,0}, {0,0}, {0,0},
+  /* r01 */ {0,0}, {0,0}, {4,0}, {0,4}, {6,2}, {2,6}, {8,4}, {4,8}, {10,6}, {6,10}, {12,8}, {8,12}, {14,10}, {0,0}, {0,0},
+  /* r02 */ {0,0}, {4,1}, {1,4}, {6,0}, {0,6}, {8,2}, {2,8}, {10,4}, {4,10}, {12,6}, {6,12}, {14,8}, {8,14}, {15,10}, {0,0},
+  /* r03 */ {0,0}, {3,4}, {6,1}, {1,6}, {8,0}, {0,8}, {10,2}, {2,10}, {12,4}, {4,12}, {14,6}, {6,14}, {15,8}, {8,15}, {0,0},
+  /* r04 */ {5,4}, {6,3}, {3,6}, {8,1}, {1,8}, {10,0}, {0,10}, {12,2}, {2,12}, {14,4}, {4,14}, {15,6}, {6,15}, {13,8}, {8,13},
+  /* r05 */ {6,5}, {5,6}, {8,3}, {3,8}, {10,1}, {1,10}, {12,0}, {0,12}, {14,2}, {2,14}, {15,4}, {4,15}, {13,6}, {6,13}, {11,8},
+  /* r06 */ {7,6}, {8,5}, {5,8}, {10,3}, {3,10}, {12,1}, {1,12}, {14,0}, {0,14}, {15,2}, {2,15}, {13,4}, {4,13}, {11,6}, {6,11},
+  /* r07 */ {8,7}, {7,8}, {10,5}, {5,10}, {12,3}, {3,12}, {14,1}, {1,14}, {15,0}, {0,15}, {13,2}, {2,13}, {11,4}, {4,11}, {9,6},
+  /* r08 */ {9,8}, {10,7}, {7,10}, {12,5}, {5,12}, {14,3}, {3,14}, {15,1}, {1,15}, {13,0}, {0,13}, {11,2}, {2,11}, {9,4}, {4,9},
+  /* r09 */ {10,9}, {9,10}, {12,7}, {7,12}, {14,5}, {5,14}, {15,3}, {3,15}, {13,1}, {1,13}, {11,0}, {0,11}, {9,2}, {2,9}, {7,4},
+  /* r10 */ {11,10}, {12,9}, {9,12}, {14,7}, {7,14}, {15,5}, {5,15}, {13,3}, {3,13}, {11,1}, {1,11}, {9,0}, {0,9}, {7,2}, {2,7},
+  /* r11 */ {0,0}, {11,12}, {14,9}, {9,14}, {15,7}, {7,15}, {13,5}, {5,13}, {11,3}, {3,11}, {9,1}, {1,9}, {7,0}, {0,7}, {0,0},
+  /* r12 */ {0,0}, {14,11}, {11,14}, {15,9}, {9,15}, {13,7}, {7,13}, {11,5}, {5,11}, {9,3}, {3,9}, {7,1}, {1,7}, {5,0}, {0,0},
+  /* r13 */ {0,0}, {0,0}, {15,11}, {11,15}, {13,9}, {9,13}, {11,7}, {7,11}, {9,5}, {5,9}, {7,3}, {3,7}, {5,1}, {0,0}, {0,0},
+  /* r14 */ {0,0}, {0,0}, {0,0}, {0,0}, {11,13}, {11,9}, {9,11}, {9,7}, {7,9}, {7,5}, {5,7}, {0,0}, {0,0}, {0,0}, {0,0},
+};
+
+static const uint8_t VALID_MASK[N_PIXELS] = {
+  /* r00 */ 0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,
+  /* r01 */ 0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
+  /* r02 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+  /* r03 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+  /* r04 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r05 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r06 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r07 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r08 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r09 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r10 */ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  /* r11 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+  /* r12 */ 0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+  /* r13 */ 0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
+  /* r14 */ 0,0,0,0,1,1,1,1,1,1,1,0,0,0,0,
+};
+
+// (i/255)^2.8 in Q16; Led_Init scales it by the timer ARR
+static const uint16_t LED_GAMMA_Q16[256] = {
+      0,     0,     0,     0,     1,     1,     2,     3,
+      4,     6,     8,    10,    13,    16,    19,    24,
+     28,    33,    39,    46,    53,    60,    69,    78,
+     88,    98,   110,   122,   135,   149,   164,   179,
+    196,   214,   232,   252,   273,   295,   317,   341,
+    366,   393,   420,   449,   478,   510,   542,   575,
+    610,   647,   684,   723,   764,   806,   849,   894,
+    940,   988,  1037,  1088,  1140,  1194,  1250,  1307,
+   1366,  1427,  1489,  1553,  1619,  1686,  1756,  1827,
+   1900,  1975,  2051,  2130,  2210,  2293,  2377,  2463,
+   2552,  2642,  2734,  2829,  2925,  3024,  3124,  3227,
+   3332,  3439,  3548,  3660,  3774,  3890,  4008,  4128,
+   4251,  4376,  4504,  4634,  4766,  4901,  5038,  5177,
+   5319,  5464,  5611,  5760,  5912,  6067,  6224,  6384,
+   6546,  6711,  6879,  7049,  7222,  7397,  7576,  7757,
+   7941,  8128,  8317,  8509,  8704,  8902,  9103,  9307,
+   9514,  9723,  9936, 10151, 10370, 10591, 10816, 11043,
+  11274, 11507, 11744, 11984, 12227, 12473, 12722, 12975,
+  13230, 13489, 13751, 14017, 14285, 14557, 14833, 15111,
+  15393, 15678, 15967, 16259, 16554, 16853, 17155, 17461,
+  17770, 18083, 18399, 18719, 19042, 19369, 19700, 20034,
+  20372, 20713, 21058, 21407, 21759, 22115, 22475, 22838,
+  23206, 23577, 23952, 24330, 24713, 25099, 25489, 25884,
+  26282, 26683, 27089, 27499, 27913, 28330, 28752, 29178,
+  29608, 30041, 30479, 30921, 31367, 31818, 32272, 32730,
+  33193, 33660, 34131, 34606, 35085, 35569, 36057, 36549,
+  37046, 37547, 38052, 38561, 39075, 39593, 40116, 40643,
+  41175, 41711, 42251, 42796, 43346, 43899, 44458, 45021,
+  45588, 46161, 46737, 47319, 47905, 48495, 49091, 49691,
+  50295, 50905, 51519, 52138, 52761, 53390, 54023, 54661,
+  55303, 55951, 56604, 57261, 57923, 58590, 59262, 59939,
+  60621, 61308, 62000, 62697, 63399, 64106, 64818, 65535,
+};
+
+// coverage 0..255 -> fb level whose light output is that share of 255 (anti-aliasing)
+static const uint8_t LED_AA_LEVEL[256] = {
+    0,  35,  45,  52,  58,  63,  67,  71,  74,  77,  80,  83,  86,  88,  90,  93,
+   95,  97,  99, 101, 103, 105, 106, 108, 110, 111, 113, 114, 116, 117, 119, 120,
+  122, 123, 124, 125, 127, 128, 129, 130, 132, 133, 134, 135, 136, 137, 138, 139,
+  140, 141, 143, 144, 145, 146, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+  156, 157, 157, 158, 159, 160, 161, 162, 162, 163, 164, 165, 165, 166, 167, 168,
+  169, 169, 170, 171, 172, 172, 173, 174, 174, 175, 176, 176, 177, 178, 179, 179,
+  180, 181, 181, 182, 183, 183, 184, 184, 185, 186, 186, 187, 188, 188, 189, 189,
+  190, 191, 191, 192, 192, 193, 194, 194, 195, 195, 196, 197, 197, 198, 198, 199,
+  199, 200, 200, 201, 202, 202, 203, 203, 204, 204, 205, 205, 206, 206, 207, 207,
+  208, 208, 209, 209, 210, 210, 211, 211, 212, 212, 213, 213, 214, 214, 215, 215,
+  216, 216, 217, 217, 218, 218, 219, 219, 220, 220, 221, 221, 222, 222, 222, 223,
+  223, 224, 224, 225, 225, 226, 226, 227, 227, 227, 228, 228, 229, 229, 230, 230,
+  230, 231, 231, 232, 232, 233, 233, 233, 234, 234, 235, 235, 235, 236, 236, 237,
+  237, 238, 238, 238, 239, 239, 240, 240, 240, 241, 241, 242, 242, 242, 243, 243,
+  243, 244, 244, 245, 245, 245, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249,
+  250, 250, 250, 251, 251, 251, 252, 252, 252, 253, 253, 254, 254, 254, 255, 255,
+};
+
+// first and last valid column per row (COLS, 0 for an empty row); VALID_MASK still rules inside
+static const uint8_t LED_ROW_SPAN[ROWS][2] = {
+  {4,10}, {2,12}, {1,13}, {1,13}, {0,14}, {0,14}, {0,14}, {0,14}, {0,14}, {0,14}, {0,14}, {1,13}, {1,13}, {2,12}, {4,10},
+};
+
+// pixel index -> ready-to-queue active-list entry
+static const ScanEntry LED_SCAN[225] = {
+  /* r00 */ {255,255,0}, {255,255,1}, {255,255,2}, {255,255,3}, {2,4,4}, {6,4,5}, {4,6,6}, {8,6,7}, {6,8,8}, {10,8,9}, {8,10,10}, {255,255,11}, {255,255,12}, {255,255,13}, {255,255,14},
+  /* r01 */ {255,255,15}, {255,255,16}, {4,0,17}, {0,4,18}, {6,2,19}, {2,6,20}, {8,4,21}, {4,8,22}, {10,6,23}, {6,10,24}, {12,8,25}, {8,12,26}, {14,10,27}, {255,255,28}, {255,255,29},
+  /* r02 */ {255,255,30}, {4,1,31}, {1,4,32}, {6,0,33}, {0,6,34}, {8,2,35}, {2,8,36}, {10,4,37}, {4,10,38}, {12,6,39}, {6,12,40}, {14,8,41}, {8,14,42}, {15,10,43}, {255,255,44},
+  /* r03 */ {255,255,45}, {3,4,46}, {6,1,47}, {1,6,48}, {8,0,49}, {0,8,50}, {10,2,51}, {2,10,52}, {12,4,53}, {4,12,54}, {14,6,55}, {6,14,56}, {15,8,57}, {8,15,58}, {255,255,59},
+  /* r04 */ {5,4,60}, {6,3,61}, {3,6,62}, {8,1,63}, {1,8,64}, {10,0,65}, {0,10,66}, {12,2,67}, {2,12,68}, {14,4,69}, {4,14,70}, {15,6,71}, {6,15,72}, {13,8,73}, {8,13,74},
+  /* r05 */ {6,5,75}, {5,6,76}, {8,3,77}, {3,8,78}, {10,1,79}, {1,10,80}, {12,0,81}, {0,12,82}, {14,2,83}, {2,14,84}, {15,4,85}, {4,15,86}, {13,6,87}, {6,13,88}, {11,8,89},
+  /* r06 */ {7,6,90}, {8,5,91}, {5,8,92}, {10,3,93}, {3,10,94}, {12,1,95}, {1,12,96}, {14,0,97}, {0,14,98}, {15,2,99}, {2,15,100}, {13,4,101}, {4,13,102}, {11,6,103}, {6,11,104},
+  /* r07 */ {8,7,105}, {7,8,106}, {10,5,107}, {5,10,108}, {12,3,109}, {3,12,110}, {14,1,111}, {1,14,112}, {15,0,113}, {0,15,114}, {13,2,115}, {2,13,116}, {11,4,117}, {4,11,118}, {9,6,119},
+  /* r08 */ {9,8,120}, {10,7,121}, {7,10,122}, {12,5,123}, {5,12,124}, {14,3,125}, {3,14,126}, {15,1,127}, {1,15,128}, {13,0,129}, {0,13,130}, {11,2,131}, {2,11,132}, {9,4,133}, {4,9,134},
+  /* r09 */ {10,9,135}, {9,10,136}, {12,7,137}, {7,12,138}, {14,5,139}, {5,14,140}, {15,3,141}, {3,15,142}, {13,1,143}, {1,13,144}, {11,0,145}, {0,11,146}, {9,2,147}, {2,9,148}, {7,4,149},
+  /* r10 */ {11,10,150}, {12,9,151}, {9,12,152}, {14,7,153}, {7,14,154}, {15,5,155}, {5,15,156}, {13,3,157}, {3,13,158}, {11,1,159}, {1,11,160}, {9,0,161}, {0,9,162}, {7,2,163}, {2,7,164},
+  /* r11 */ {255,255,165}, {11,12,166}, {14,9,167}, {9,14,168}, {15,7,169}, {7,15,170}, {13,5,171}, {5,13,172}, {11,3,173}, {3,11,174}, {9,1,175}, {1,9,176}, {7,0,177}, {0,7,178}, {255,255,179},
+  /* r12 */ {255,255,180}, {14,11,181}, {11,14,182}, {15,9,183}, {9,15,184}, {13,7,185}, {7,13,186}, {11,5,187}, {5,11,188}, {9,3,189}, {3,9,190}, {7,1,191}, {1,7,192}, {5,0,193}, {255,255,194},
+  /* r13 */ {255,255,195}, {255,255,196}, {15,11,197}, {11,15,198}, {13,9,199}, {9,13,200}, {11,7,201}, {7,11,202}, {9,5,203}, {5,9,204}, {7,3,205}, {3,7,206}, {5,1,207}, {255,255,208}, {255,255,209},
+  /* r14 */ {255,255,210}, {255,255,211}, {255,255,212}, {255,255,213}, {11,13,214}, {11,9,215}, {9,11,216}, {9,7,217}, {7,9,218}, {7,5,219}, {5,7,220}, {255,255,221}, {255,255,222}, {255,255,223}, {255,255,224},
+};
+
+// indices of every pixel that can light, in row-major order
+static const uint8_t LED_VALID_PIX[LED_N_VALID] = {
+  4, 5, 6, 7, 8, 9, 10, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+  26, 27, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 46,
+  47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+  177, 178, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 214, 215, 216, 217, 218, 219,
+  220,
+};
+
+// Register images per pixel and port: the MODER fields of both pins
+// (output = field & 0x55555555) and the BSRR word driving them.
+typedef struct { uint32_t moder[LED_N_PORTS], bsrr[LED_N_PORTS]; } LedGpio;
+
+static GPIO_TypeDef *const LED_PORTS[LED_N_PORTS] = { GPIOA, GPIOB };
+
+// Read by the scan ISR on every slot, so keep a copy in SRAM.
+static const LedGpio LED_GPIO[N_PIXELS] RAMDATA(led_gpio) = {
+  [  4] = {{0x00030000, 0x00000003}, {0x00000100, 0x00010000}},
+  [  5] = {{0x00000000, 0x00000303}, {0x00000000, 0x00010010}},
+  [  6] = {{0x00000000, 0x00000303}, {0x00000000, 0x00100001}},
+  [  7] = {{0x03000000, 0x00000300}, {0x00001000, 0x00100000}},
+  [  8] = {{0x03000000, 0x00000300}, {0x10000000, 0x00000010}},
+  [  9] = {{0x03C00000, 0x00000000}, {0x10000800, 0x00000000}},
+  [ 10] = {{0x03C00000, 0x00000000}, {0x08001000, 0x00000000}},
+  [ 17] = {{0x00000000, 0x0000000F}, {0x00000000, 0x00020001}},
+  [ 18] = {{0x00000000, 0x0000000F}, {0x00000000, 0x00010002}},
+  [ 19] = {{0x00030000, 0x00000300}, {0x01000000, 0x00000010}},
+  [ 20] = {{0x00030000, 0x00000300}, {0x00000100, 0x00100000}},
+  [ 21] = {{0x03000000, 0x00000003}, {0x00001000, 0x00010000}},
+  [ 22] = {{0x03000000, 0x00000003}, {0x10000000, 0x00000001}},
+  [ 23] = {{0x00C00000, 0x00000300}, {0x00000800, 0x00100000}},
+  [ 24] = {{0x00C00000, 0x00000300}, {0x08000000, 0x00000010}},
+  [ 25] = {{0x030C0000, 0x00000000}, {0x10000200, 0x00000000}},
+  [ 26] = {{0x030C0000, 0x00000000}, {0x02001000, 0x00000000}},
+  [ 27] = {{0x00F00000, 0x00000000}, {0x08000400, 0x00000000}},
+  [ 31] = {{0x00000000, 0x000000C3}, {0x00000000, 0x00080001}},
+  [ 32] = {{0x00000000, 0x000000C3}, {0x00000000, 0x00010008}},
+  [ 33] = {{0x00000000, 0x0000030C}, {0x00000000, 0x00020010}},
+  [ 34] = {{0x00000000, 0x0000030C}, {0x00000000, 0x00100002}},
+  [ 35] = {{0x03030000, 0x00000000}, {0x01001000, 0x00000000}},
+  [ 36] = {{0x03030000, 0x00000000}, {0x10000100, 0x00000000}},
+  [ 37] = {{0x00C00000, 0x00000003}, {0x00000800, 0x00010000}},
+  [ 38] = {{0x00C00000, 0x00000003}, {0x08000000, 0x00000001}},
+  [ 39] = {{0x000C0000, 0x00000300}, {0x00000200, 0x00100000}},
+  [ 40] = {{0x000C0000, 0x00000300}, {0x02000000, 0x00000010}},
+  [ 41] = {{0x03300000, 0x00000000}, {0x10000400, 0x00000000}},
+  [ 42] = {{0x03300000, 0x00000000}, {0x04001000, 0x00000000}},
+  [ 43] = {{0x00C00000, 0x0000C000}, {0x08000000, 0x00000080}},
+  [ 46] = {{0x00000000, 0x00000C03}, {0x00000000, 0x00010020}},
+  [ 47] = {{0x00000000, 0x000003C0}, {0x00000000, 0x00080010}},
+  [ 48] = {{0x00000000, 0x000003C0}, {0x00000000, 0x00100008}},
+  [ 49] = {{0x03000000, 0x0000000C}, {0x00001000, 0x00020000}},
+  [ 50] = {{0x03000000, 0x0000000C}, {0x10000000, 0x00000002}},
+  [ 51] = {{0x00C30000, 0x00000000}, {0x01000800, 0x00000000}},
+  [ 52] = {{0x00C30000, 0x00000000}, {0x08000100, 0x00000000}},
+  [ 53] = {{0x000C0000, 0x00000003}, {0x00000200, 0x00010000}},
+  [ 54] = {{0x000C0000, 0x00000003}, {0x02000000, 0x00000001}},
+  [ 55] = {{0x00300000, 0x00000300}, {0x00000400, 0x00100000}},
+  [ 56] = {{0x00300000, 0x00000300}, {0x04000000, 0x00000010}},
+  [ 57] = {{0x03000000, 0x0000C000}, {0x10000000, 0x00000080}},
+  [ 58] = {{0x03000000, 0x0000C000}, {0x00001000, 0x00800000}},
+  [ 60] = {{0x000000C0, 0x00000003}, {0x00000008, 0x00010000}},
+  [ 61] = {{0x00000000, 0x00000F00}, {0x00000000, 0x00200010}},
+  [ 62] = {{0x00000000, 0x00000F00}, {0x00000000, 0x00100020}},
+  [ 63] = {{0x03000000, 0x000000C0}, {0x00001000, 0x00080000}},
+  [ 64] = {{0x03000000, 0x000000C0}, {0x10000000, 0x00000008}},
+  [ 65] = {{0x00C00000, 0x0000000C}, {0x00000800, 0x00020000}},
+  [ 66] = {{0x00C00000, 0x0000000C}, {0x08000000, 0x00000002}},
+  [ 67] = {{0x000F0000, 0x00000000}, {0x01000200, 0x00000000}},
+  [ 68] = {{0x000F0000, 0x00000000}, {0x02000100, 0x00000000}},
+  [ 69] = {{0x00300000, 0x00000003}, {0x00000400, 0x00010000}},
+  [ 70] = {{0x00300000, 0x00000003}, {0x04000000, 0x00000001}},
+  [ 71] = {{0x00000000, 0x0000C300}, {0x00000000, 0x00100080}},
+  [ 72] = {{0x00000000, 0x0000C300}, {0x00000000, 0x00800010}},
+  [ 73] = {{0xC3000000, 0x00000000}, {0x10008000, 0x00000000}},
+  [ 74] = {{0xC3000000, 0x00000000}, {0x80001000, 0x00000000}},
+  [ 75] = {{0x000000C0, 0x00000300}, {0x00080000, 0x00000010}},
+  [ 76] = {{0x000000C0, 0x00000300}, {0x00000008, 0x00100000}},
+  [ 77] = {{0x03000000, 0x00000C00}, {0x00001000, 0x00200000}},
+  [ 78] = {{0x03000000, 0x00000C00}, {0x10000000, 0x00000020}},
+  [ 79] = {{0x00C00000, 0x000000C0}, {0x00000800, 0x00080000}},
+  [ 80] = {{0x00C00000, 0x000000C0}, {0x08000000, 0x00000008}},
+  [ 81] = {{0x000C0000, 0x0000000C}, {0x00000200, 0x00020000}},
+  [ 82] = {{0x000C0000, 0x0000000C}, {0x02000000, 0x00000002}},
+  [ 83] = {{0x00330000, 0x00000000}, {0x01000400, 0x00000000}},
+  [ 84] = {{0x00330000, 0x00000000}, {0x04000100, 0x00000000}},
+  [ 85] = {{0x00000000, 0x0000C003}, {0x00000000, 0x00010080}},
+  [ 86] = {{0x00000000, 0x0000C003}, {0x00000000, 0x00800001}},
+  [ 87] = {{0xC0000000, 0x00000300}, {0x00008000, 0x00100000}},
+  [ 88] = {{0xC0000000, 0x00000300}, {0x80000000, 0x00000010}},
+  [ 89] = {{0x03000000, 0x00003000}, {0x10000000, 0x00000040}},
+  [ 90] = {{0x00000030, 0x00000300}, {0x00000004, 0x00100000}},
+  [ 91] = {{0x030000C0, 0x00000000}, {0x00081000, 0x00000000}},
+  [ 92] = {{0x030000C0, 0x00000000}, {0x10000008, 0x00000000}},
+  [ 93] = {{0x00C00000, 0x00000C00}, {0x00000800, 0x00200000}},
+  [ 94] = {{0x00C00000, 0x00000C00}, {0x08000000, 0x00000020}},
+  [ 95] = {{0x000C0000, 0x000000C0}, {0x00000200, 0x00080000}},
+  [ 96] = {{0x000C0000, 0x000000C0}, {0x02000000, 0x00000008}},
+  [ 97] = {{0x00300000, 0x0000000C}, {0x00000400, 0x00020000}},
+  [ 98] = {{0x00300000, 0x0000000C}, {0x04000000, 0x00000002}},
+  [ 99] = {{0x00030000, 0x0000C000}, {0x01000000, 0x00000080}},
+  [100] = {{0x00030000, 0x0000C000}, {0x00000100, 0x00800000}},
+  [101] = {{0xC0000000, 0x00000003}, {0x00008000, 0x00010000}},
+  [102] = {{0xC0000000, 0x00000003}, {0x80000000, 0x00000001}},
+  [103] = {{0x00000000, 0x00003300}, {0x00000000, 0x00100040}},
+  [104] = {{0x00000000, 0x00003300}, {0x00000000, 0x00400010}},
+  [105] = {{0x03000030, 0x00000000}, {0x00041000, 0x00000000}},
+  [106] = {{0x03000030, 0x00000000}, {0x10000004, 0x00000000}},
+  [107] = {{0x00C000C0, 0x00000000}, {0x00080800, 0x00000000}},
+  [108] = {{0x00C000C0, 0x00000000}, {0x08000008, 0x00000000}},
+  [109] = {{0x000C0000, 0x00000C00}, {0x00000200, 0x00200000}},
+  [110] = {{0x000C0000, 0x00000C00}, {0x02000000, 0x00000020}},
+  [111] = {{0x00300000, 0x000000C0}, {0x00000400, 0x00080000}},
+  [112] = {{0x00300000, 0x000000C0}, {0x04000000, 0x00000008}},
+  [113] = {{0x00000000, 0x0000C00C}, {0x00000000, 0x00020080}},
+  [114] = {{0x00000000, 0x0000C00C}, {0x00000000, 0x00800002}},
+  [115] = {{0xC0030000, 0x00000000}, {0x01008000, 0x00000000}},
+  [116] = {{0xC0030000, 0x00000000}, {0x80000100, 0x00000000}},
+  [117] = {{0x00000000, 0x00003003}, {0x00000000, 0x00010040}},
+  [118] = {{0x00000000, 0x00003003}, {0x00000000, 0x00400001}},
+  [119] = {{0x0000000C, 0x00000300}, {0x00000002, 0x00100000}},
+  [120] = {{0x0300000C, 0x00000000}, {0x10000002, 0x00000000}},
+  [121] = {{0x00C00030, 0x00000000}, {0x00040800, 0x00000000}},
+  [122] = {{0x00C00030, 0x00000000}, {0x08000004, 0x00000000}},
+  [123] = {{0x000C00C0, 0x00000000}, {0x00080200, 0x00000000}},
+  [124] = {{0x000C00C0, 0x00000000}, {0x02000008, 0x00000000}},
+  [125] = {{0x00300000, 0x00000C00}, {0x00000400, 0x00200000}},
+  [126] = {{0x00300000, 0x00000C00}, {0x04000000, 0x00000020}},
+  [127] = {{0x00000000, 0x0000C0C0}, {0x00000000, 0x00080080}},
+  [128] = {{0x00000000, 0x0000C0C0}, {0x00000000, 0x00800008}},
+  [129] = {{0xC0000000, 0x0000000C}, {0x00008000, 0x00020000}},
+  [130] = {{0xC0000000, 0x0000000C}, {0x80000000, 0x00000002}},
+  [131] = {{0x00030000, 0x00003000}, {0x01000000, 0x00000040}},
+  [132] = {{0x00030000, 0x00003000}, {0x00000100, 0x00400000}},
+  [133] = {{0x0000000C, 0x00000003}, {0x00000002, 0x00010000}},
+  [134] = {{0x0000000C, 0x00000003}, {0x00020000, 0x00000001}},
+  [135] = {{0x00C0000C, 0x00000000}, {0x00020800, 0x00000000}},
+  [136] = {{0x00C0000C, 0x00000000}, {0x08000002, 0x00000000}},
+  [137] = {{0x000C0030, 0x00000000}, {0x00040200, 0x00000000}},
+  [138] = {{0x000C0030, 0x00000000}, {0x02000004, 0x00000000}},
+  [139] = {{0x003000C0, 0x00000000}, {0x00080400, 0x00000000}},
+  [140] = {{0x003000C0, 0x00000000}, {0x04000008, 0x00000000}},
+  [141] = {{0x00000000, 0x0000CC00}, {0x00000000, 0x00200080}},
+  [142] = {{0x00000000, 0x0000CC00}, {0x00000000, 0x00800020}},
+  [143] = {{0xC0000000, 0x000000C0}, {0x00008000, 0x00080000}},
+  [144] = {{0xC0000000, 0x000000C0}, {0x80000000, 0x00000008}},
+  [145] = {{0x00000000, 0x0000300C}, {0x00000000, 0x00020040}},
+  [146] = {{0x00000000, 0x0000300C}, {0x00000000, 0x00400002}},
+  [147] = {{0x0003000C, 0x00000000}, {0x01000002, 0x00000000}},
+  [148] = {{0x0003000C, 0x00000000}, {0x00020100, 0x00000000}},
+  [149] = {{0x00000030, 0x00000003}, {0x00000004, 0x00010000}},
+  [150] = {{0x00C00000, 0x00003000}, {0x08000000, 0x00000040}},
+  [151] = {{0x000C000C, 0x00000000}, {0x00020200, 0x00000000}},
+  [152] = {{0x000C000C, 0x00000000}, {0x02000002, 0x00000000}},
+  [153] = {{0x00300030, 0x00000000}, {0x00040400, 0x00000000}},
+  [154] = {{0x00300030, 0x00000000}, {0x04000004, 0x00000000}},
+  [155] = {{0x000000C0, 0x0000C000}, {0x00080000, 0x00000080}},
+  [156] = {{0x000000C0, 0x0000C000}, {0x00000008, 0x00800000}},
+  [157] = {{0xC0000000, 0x00000C00}, {0x00008000, 0x00200000}},
+  [158] = {{0xC0000000, 0x00000C00}, {0x80000000, 0x00000020}},
+  [159] = {{0x00000000, 0x000030C0}, {0x00000000, 0x00080040}},
+  [160] = {{0x00000000, 0x000030C0}, {0x00000000, 0x00400008}},
+  [161] = {{0x0000000C, 0x0000000C}, {0x00000002, 0x00020000}},
+  [162] = {{0x0000000C, 0x0000000C}, {0x00020000, 0x00000002}},
+  [163] = {{0x00030030, 0x00000000}, {0x01000004, 0x00000000}},
+  [164] = {{0x00030030, 0x00000000}, {0x00040100, 0x00000000}},
+  [166] = {{0x000C0000, 0x00003000}, {0x02000000, 0x00000040}},
+  [167] = {{0x0030000C, 0x00000000}, {0x00020400, 0x00000000}},
+  [168] = {{0x0030000C, 0x00000000}, {0x04000002, 0x00000000}},
+  [169] = {{0x00000030, 0x0000C000}, {0x00040000, 0x00000080}},
+  [170] = {{0x00000030, 0x0000C000}, {0x00000004, 0x00800000}},
+  [171] = {{0xC00000C0, 0x00000000}, {0x00088000, 0x00000000}},
+  [172] = {{0xC00000C0, 0x00000000}, {0x80000008, 0x00000000}},
+  [173] = {{0x00000000, 0x00003C00}, {0x00000000, 0x00200040}},
+  [174] = {{0x00000000, 0x00003C00}, {0x00000000, 0x00400020}},
+  [175] = {{0x0000000C, 0x000000C0}, {0x00000002, 0x00080000}},
+  [176] = {{0x0000000C, 0x000000C0}, {0x00020000, 0x00000008}},
+  [177] = {{0x00000030, 0x0000000C}, {0x00000004, 0x00020000}},
+  [178] = {{0x00000030, 0x0000000C}, {0x00040000, 0x00000002}},
+  [181] = {{0x00300000, 0x00003000}, {0x00000400, 0x00400000}},
+  [182] = {{0x00300000, 0x00003000}, {0x04000000, 0x00000040}},
+  [183] = {{0x0000000C, 0x0000C000}, {0x00020000, 0x00000080}},
+  [184] = {{0x0000000C, 0x0000C000}, {0x00000002, 0x00800000}},
+  [185] = {{0xC0000030, 0x00000000}, {0x00048000, 0x00000000}},
+  [186] = {{0xC0000030, 0x00000000}, {0x80000004, 0x00000000}},
+  [187] = {{0x000000C0, 0x00003000}, {0x00080000, 0x00000040}},
+  [188] = {{0x000000C0, 0x00003000}, {0x00000008, 0x00400000}},
+  [189] = {{0x0000000C, 0x00000C00}, {0x00000002, 0x00200000}},
+  [190] = {{0x0000000C, 0x00000C00}, {0x00020000, 0x00000020}},
+  [191] = {{0x00000030, 0x000000C0}, {0x00000004, 0x00080000}},
+  [192] = {{0x00000030, 0x000000C0}, {0x00040000, 0x00000008}},
+  [193] = {{0x000000C0, 0x0000000C}, {0x00000008, 0x00020000}},
+  [197] = {{0x00000000, 0x0000F000}, {0x00000000, 0x00400080}},
+  [198] = {{0x00000000, 0x0000F000}, {0x00000000, 0x00800040}},
+  [199] = {{0xC000000C, 0x00000000}, {0x00028000, 0x00000000}},
+  [200] = {{0xC000000C, 0x00000000}, {0x80000002, 0x00000000}},
+  [201] = {{0x00000030, 0x00003000}, {0x00040000, 0x00000040}},
+  [202] = {{0x00000030, 0x00003000}, {0x00000004, 0x00400000}},
+  [203] = {{0x000000CC, 0x00000000}, {0x00080002, 0x00000000}},
+  [204] = {{0x000000CC, 0x00000000}, {0x00020008, 0x00000000}},
+  [205] = {{0x00000030, 0x00000C00}, {0x00000004, 0x00200000}},
+  [206] = {{0x00000030, 0x00000C00}, {0x00040000, 0x00000020}},
+  [207] = {{0x000000C0, 0x000000C0}, {0x00000008, 0x00080000}},
+  [214] = {{0xC0000000, 0x00003000}, {0x80000000, 0x00000040}},
+  [215] = {{0x0000000C, 0x00003000}, {0x00020000, 0x00000040}},
+  [216] = {{0x0000000C, 0x00003000}, {0x00000002, 0x00400000}},
+  [217] = {{0x0000003C, 0x00000000}, {0x00040002, 0x00000000}},
+  [218] = {{0x0000003C, 0x00000000}, {0x00020004, 0x00000000}},
+  [219] = {{0x000000F0, 0x00000000}, {0x00080004, 0x00000000}},
+  [220] = {{0x000000F0, 0x00000000}, {0x00040008, 0x00000000}},
+};
@@ -19,9 +19,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "adc.h"
+#include "dma.h"
 #include "rtc.h"
 #include "spi.h"
 #include "tim.h"
+#include "lptim.h"
 #include "gpio.h"
 #include "led_driver.h"
 #include "ICM426xx.h"
@@ -30,7 +32,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include <stdio.h>
+#include "profile.h"
+#include "anim.h"
+#include "text.h"
+#include "gfx.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -74,7 +80,10 @@ void SystemClock_Config(void);
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-
+  Profile_Init();   // CYCCNT from reset: scan stats, and boot-to-first-pixel under LED_BENCH
+#ifdef LED_BENCH
+  DWT->CYCCNT = 0;  // a debugger reset leaves the counter running
+#endif
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -95,12 +104,14 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_ADC1_Init();
   MX_RTC_Init();
   MX_SPI1_Init();
   MX_TIM2_Init();
   MX_TIM6_Init();
   MX_TIM7_Init();
+  MX_LPTIM1_Init();
   /* USER CODE BEGIN 2 */
   Led_Init();
   Display_Clear();
@@ -115,11 +126,10 @@ int main(void)
 
   // draw_byte_center(0xFF, 64);
   // HAL_Delay(100);
-  ICM426xx_init();
+  ICM426xx_InitStart();   // stepped from App_Loop; the clock comes up meanwhile
   // HAL_Delay(100);
   // draw_byte_center(ICM426xx_get_device_id(), 64);
   // /* USER CODE END 2 */
-  HAL_Delay(100);
   // draw_byte_center(ICM426xx_interruptStatus(), 64);
   // HAL_Delay(100);
   // draw_byte_center(ICM426xx_interruptStatus(), 64);
@@ -127,8 +137,63 @@ int main(void)
 
   // Display_Clear();
 
+#ifdef LED_BENCH
+  uint32_t reveal_ms = HAL_GetTick();
+#endif
   App_Init();
-  
+
+#ifdef LED_BENCH
+  while (Anim_Busy()) App_Loop();     // let the boot reveal finish first
+  reveal_ms = HAL_GetTick() - reveal_ms;
+  // the blocking curtain spun in HAL_Delay, so it was busy for all of reveal_ms
+  printf("curtain reveal: %lu ms, %lu cyc busy of %lu (blocking: all)\n", (unsigned long)reveal_ms,
+         (unsigned long)Anim_BenchBusyCycles(), (unsigned long)(reveal_ms * (SystemCoreClock / 1000u)));
+
+  uint32_t ram_cyc, flash_cyc;
+  Led_BenchScan(1000, &ram_cyc, &flash_cyc);
+  printf("scan slot: sram %lu cyc, flash %lu cyc\n",
+         (unsigned long)ram_cyc, (unsigned long)flash_cyc);
+  printf("reset to first pixel: %lu cyc\n", (unsigned long)Led_BenchFirstPixel());
+  uint32_t gamma_powf, gamma_table;
+  Led_BenchGamma(&gamma_powf, &gamma_table);
+  printf("boot gamma build: powf %lu cyc, table %lu cyc\n", (unsigned long)gamma_powf, (unsigned long)gamma_table);
+  uint32_t ccr_div, ccr_lut;
+  Led_BenchCcr(1000, &ccr_div, &ccr_lut);
+  printf("slot ccr: divide %lu cyc, table %lu cyc\n", (unsigned long)ccr_div, (unsigned long)ccr_lut);
+
+  uint32_t t0 = Profile_Cycles();
+  for (uint8_t s = 0; s < 60; ++s) Led_DrawClock(12, 34, s);
+  printf("Led_DrawClock: %lu cyc avg\n", (unsigned long)((Profile_Cycles() - t0) / 60u));
+  printf("marquee: %lu cyc per scrolled frame\n", (unsigned long)Text_BenchScroll());
+
+  Led_DrawAnalog(12, 34, 0);
+  t0 = Profile_Cycles();
+  for (uint8_t s = 1; s <= 60; ++s) Led_DrawAnalog(12, 34 + s / 60u, s % 60u);
+  printf("Led_DrawAnalog: %lu cyc per update\n", (unsigned long)((Profile_Cycles() - t0) / 60u));
+
+  uint32_t gfx_fixed, gfx_float;
+  Gfx_Bench(&gfx_fixed, &gfx_float);
+  printf("gfx scene: Q8 %lu cyc, float %lu cyc\n", (unsigned long)gfx_fixed, (unsigned long)gfx_float);
+
+  printf("imu ready: %lu ms after reset\n", (unsigned long)ICM426xx_BenchReadyTick());
+  printf("imu profiles: off %lu, apex %lu, lp50 %lu, ln200 %lu uA\n",
+         (unsigned long)ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_OFF),
+         (unsigned long)ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_APEX),
+         (unsigned long)ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_ACCEL_LP_50),
+         (unsigned long)ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_LN_200));
+  uint32_t imu_block, imu_dma;
+  ICM426xx_BenchFifo(&imu_block, &imu_dma);
+  printf("imu fifo: blocking %lu us/sample, dma %lu us/sample busy\n",
+         (unsigned long)(imu_block / (SystemCoreClock / 1000000u)),
+         (unsigned long)(imu_dma / (SystemCoreClock / 1000000u)));
+  uint32_t cv_float, cv_raw, cv_q16;
+  ICM426xx_BenchConvert(&cv_float, &cv_raw, &cv_q16);
+  printf("imu convert: float %lu, raw %lu, raw+q16 %lu cyc/sample\n",
+         (unsigned long)cv_float, (unsigned long)cv_raw, (unsigned long)cv_q16);
+  uint32_t fu_float, fu_fixed;
+  ICM426xx_BenchFusion(&fu_float, &fu_fixed);
+  printf("imu fusion: float %lu cyc, Q28 %lu cyc per update\n", (unsigned long)fu_float, (unsigned long)fu_fixed);
+#endif
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
@@ -149,7 +214,7 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
         // physics @ ~60 Hz
         // ICM426xx_loop();
         // ICM426xx_Sample sample = ICM426xx_value();
-        // fluid_update(sample.ax, sample.ay, 16);
+        // fluid_update(sample.ax, sample.ay, 16000);
     }
 
     if (htim->Instance == TIM7) {
@@ -165,6 +230,32 @@ void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
   }
 }
 
+/* Ambient display: LPTIM1 (LSE) stands in for TIM2 as the slot clock */
+void HAL_LPTIM_AutoReloadMatchCallback(LPTIM_HandleTypeDef *hlptim)
+{
+  if (hlptim->Instance == LPTIM1) {
+    Led_AmbientSlotStart();
+  }
+}
+
+void HAL_LPTIM_CompareMatchCallback(LPTIM_HandleTypeDef *hlptim)
+{
+  if (hlptim->Instance == LPTIM1) {
+    Led_ScanSlotEnd();
+  }
+}
+
+/* SPI1 DMA: the ICM426xx driver raises CS and runs the queued callback */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  ICM426xx_SpiComplete(hspi, true);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  ICM426xx_SpiComplete(hspi, false);
+}
+
 /**
   * @brief System Clock Configuration
   * @retval None
@@ -225,7 +316,36 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
+/* Ambient display clock: MSI range 6 (4 MHz) on regulator range 2.
+   LSE, the RTC and MSI auto-calibration stay as SystemClock_Config left
+   them; call SystemClock_Config() again to return to 16 MHz. */
+void SystemClock_ConfigAmbient(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
 
+  /* Slow down first (HAL re-times SysTick), then drop the regulator */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_MSI;
+  RCC_OscInitStruct.MSIState = RCC_MSI_ON;
+  RCC_OscInitStruct.MSICalibrationValue = 0;
+  RCC_OscInitStruct.MSIClockRange = RCC_MSIRANGE_6;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/* printf() -> SWO (ITM stimulus port 0); a no-op when no probe is attached */
+int __io_putchar(int ch)
+{
+  ITM_SendChar((uint32_t)ch);
+  return ch;
+}
 /* USER CODE END 4 */
 
 /**
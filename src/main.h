@@ -46,13 +46,24 @@ extern "C" {
 
 /* Exported macro ------------------------------------------------------------*/
 /* USER CODE BEGIN EM */
-
+/* Hot-path placement in SRAM. Both sections sit inside the linker's .data
+   output section, so the startup copy loop moves them out of flash before
+   main(). Build with -DNO_RAMFUNC to keep everything in flash (A/B runs). */
+#ifndef NO_RAMFUNC
+#define RAMFUNC          __attribute__((section(".RamFunc")))
+#define RAMDATA(name)    __attribute__((section(".data.ram." #name)))
+#else
+#define RAMFUNC
+#define RAMDATA(name)
+#endif
 /* USER CODE END EM */
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void SystemClock_Config(void);
+void SystemClock_ConfigAmbient(void);   // 4 MHz, range 2; SystemClock_Config() undoes it
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,18 @@
+#pragma once
+#include "main.h"
+
+// DWT cycle counter helpers (Cortex-M4 debug block, always present on L4).
+// Counts core clocks, so divide by SystemCoreClock for time. Profile_Init
+// only enables the counter; main() calls it once at reset and every user
+// takes differences, so nothing may zero CYCCNT behind their back.
+
+static inline void Profile_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t Profile_Cycles(void)
+{
+    return DWT->CYCCNT;
+}
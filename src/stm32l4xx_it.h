@@ -57,7 +57,10 @@ void PendSV_Handler(void);
 void SysTick_Handler(void);
 // void EXTI0_IRQHandler(void);
 void EXTI3_IRQHandler(void);
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
 void TIM2_IRQHandler(void);
+void LPTIM1_IRQHandler(void);
 /* USER CODE BEGIN EFP */
 
 /* USER CODE END EFP */
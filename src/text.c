@@ -0,0 +1,239 @@
+#include "text.h"
+#include "led_driver.h"
+#include "anim.h"
+#include "profile.h"
+#include <stddef.h>
+
+#define TEXT_GAP     1        // blank columns between glyphs
+#define GLYPH_MAX_W  5
+
+/* Variable-width 5-row font, stored as columns (bit r = row r, top first)
+   so a glyph is copied into the strip as-is. Width 0 = no glyph. */
+#define PROP_FIRST   ' '
+#define PROP_LAST    'Z'
+typedef struct { uint8_t w; uint8_t col[GLYPH_MAX_W]; } PropGlyph;
+
+static const PropGlyph PROP_5[PROP_LAST - PROP_FIRST + 1] = {
+  [' ' - PROP_FIRST] = { 2, { 0x00, 0x00 } },
+  ['!' - PROP_FIRST] = { 1, { 0x17 } },
+  ['%' - PROP_FIRST] = { 3, { 0x19, 0x04, 0x13 } },
+  ['\'' - PROP_FIRST] = { 1, { 0x03 } },
+  ['(' - PROP_FIRST] = { 2, { 0x0E, 0x11 } },
+  [')' - PROP_FIRST] = { 2, { 0x11, 0x0E } },
+  ['+' - PROP_FIRST] = { 3, { 0x04, 0x0E, 0x04 } },
+  [',' - PROP_FIRST] = { 1, { 0x18 } },
+  ['-' - PROP_FIRST] = { 3, { 0x04, 0x04, 0x04 } },
+  ['.' - PROP_FIRST] = { 1, { 0x10 } },
+  ['/' - PROP_FIRST] = { 3, { 0x18, 0x04, 0x03 } },
+  ['0' - PROP_FIRST] = { 3, { 0x1F, 0x11, 0x1F } },
+  ['1' - PROP_FIRST] = { 2, { 0x02, 0x1F } },
+  ['2' - PROP_FIRST] = { 3, { 0x1D, 0x15, 0x17 } },
+  ['3' - PROP_FIRST] = { 3, { 0x15, 0x15, 0x1F } },
+  ['4' - PROP_FIRST] = { 3, { 0x07, 0x04, 0x1F } },
+  ['5' - PROP_FIRST] = { 3, { 0x17, 0x15, 0x1D } },
+  ['6' - PROP_FIRST] = { 3, { 0x1F, 0x15, 0x1D } },
+  ['7' - PROP_FIRST] = { 3, { 0x01, 0x1D, 0x03 } },
+  ['8' - PROP_FIRST] = { 3, { 0x1F, 0x15, 0x1F } },
+  ['9' - PROP_FIRST] = { 3, { 0x17, 0x15, 0x1F } },
+  [':' - PROP_FIRST] = { 1, { 0x0A } },
+  ['=' - PROP_FIRST] = { 3, { 0x0A, 0x0A, 0x0A } },
+  ['?' - PROP_FIRST] = { 3, { 0x01, 0x15, 0x02 } },
+  ['A' - PROP_FIRST] = { 3, { 0x1E, 0x05, 0x1E } },
+  ['B' - PROP_FIRST] = { 3, { 0x1F, 0x15, 0x0A } },
+  ['C' - PROP_FIRST] = { 3, { 0x0E, 0x11, 0x11 } },
+  ['D' - PROP_FIRST] = { 3, { 0x1F, 0x11, 0x0E } },
+  ['E' - PROP_FIRST] = { 3, { 0x1F, 0x15, 0x11 } },
+  ['F' - PROP_FIRST] = { 3, { 0x1F, 0x05, 0x01 } },
+  ['G' - PROP_FIRST] = { 3, { 0x0E, 0x11, 0x1D } },
+  ['H' - PROP_FIRST] = { 3, { 0x1F, 0x04, 0x1F } },
+  ['I' - PROP_FIRST] = { 1, { 0x1F } },
+  ['J' - PROP_FIRST] = { 3, { 0x08, 0x10, 0x0F } },
+  ['K' - PROP_FIRST] = { 3, { 0x1F, 0x04, 0x1B } },
+  ['L' - PROP_FIRST] = { 3, { 0x1F, 0x10, 0x10 } },
+  ['M' - PROP_FIRST] = { 5, { 0x1F, 0x02, 0x04, 0x02, 0x1F } },
+  ['N' - PROP_FIRST] = { 4, { 0x1F, 0x02, 0x04, 0x1F } },
+  ['O' - PROP_FIRST] = { 3, { 0x0E, 0x11, 0x0E } },
+  ['P' - PROP_FIRST] = { 3, { 0x1F, 0x05, 0x02 } },
+  ['Q' - PROP_FIRST] = { 4, { 0x0E, 0x11, 0x09, 0x16 } },
+  ['R' - PROP_FIRST] = { 3, { 0x1F, 0x05, 0x1A } },
+  ['S' - PROP_FIRST] = { 3, { 0x12, 0x15, 0x09 } },
+  ['T' - PROP_FIRST] = { 3, { 0x01, 0x1F, 0x01 } },
+  ['U' - PROP_FIRST] = { 3, { 0x1F, 0x10, 0x1F } },
+  ['V' - PROP_FIRST] = { 3, { 0x0F, 0x10, 0x0F } },
+  ['W' - PROP_FIRST] = { 5, { 0x1F, 0x08, 0x04, 0x08, 0x1F } },
+  ['X' - PROP_FIRST] = { 3, { 0x1B, 0x04, 0x1B } },
+  ['Y' - PROP_FIRST] = { 3, { 0x03, 0x1C, 0x03 } },
+  ['Z' - PROP_FIRST] = { 3, { 0x19, 0x15, 0x13 } },
+};
+
+#define TINY_W  3
+#define TINY_H  4
+
+static const uint8_t FONT_H[] = {
+  [TEXT_FONT_HEX_3x5]  = HEX_H,
+  [TEXT_FONT_TINY_4x3] = TINY_H,
+  [TEXT_FONT_PROP]     = 5,
+};
+
+// Row-major glyph (MSB of the w bits = leftmost pixel) → columns
+static uint8_t rows_to_cols(const uint8_t *rows, uint8_t w, uint8_t h, uint8_t *col)
+{
+  for (uint8_t x = 0; x < w; ++x) {
+    uint8_t bits = 0;
+    for (uint8_t r = 0; r < h; ++r)
+      bits |= (uint8_t)(((rows[r] >> (w - 1u - x)) & 1u) << r);
+    col[x] = bits;
+  }
+  return w;
+}
+
+static uint8_t prop_glyph(char ch, uint8_t *col)
+{
+  if (ch >= 'a' && ch <= 'z') ch = (char)(ch - 'a' + 'A');
+  if (ch < PROP_FIRST || ch > PROP_LAST || !PROP_5[ch - PROP_FIRST].w) ch = '?';
+  const PropGlyph *g = &PROP_5[ch - PROP_FIRST];
+  for (uint8_t x = 0; x < g->w; ++x) col[x] = g->col[x];
+  return g->w;
+}
+
+// Columns of one character in the given font; 0 = nothing to draw
+static uint8_t glyph_cols(Text_Font font, char ch, uint8_t *col)
+{
+  switch (font) {
+    case TEXT_FONT_HEX_3x5:
+      if (ch >= '0' && ch <= '9') return rows_to_cols(HEX_3x5[ch - '0'], HEX_W, HEX_H, col);
+      if (ch >= 'A' && ch <= 'F') return rows_to_cols(HEX_3x5[ch - 'A' + 10], HEX_W, HEX_H, col);
+      if (ch >= 'a' && ch <= 'f') return rows_to_cols(HEX_3x5[ch - 'a' + 10], HEX_W, HEX_H, col);
+      return prop_glyph(ch, col);          // same height, so the rest borrows PROP
+
+    case TEXT_FONT_TINY_4x3:
+      if (ch >= '0' && ch <= '9') return rows_to_cols(TINY_4x3[ch - '0'], TINY_W, TINY_H, col);
+      switch (ch) {
+        case ' ': col[0] = 0x00; col[1] = 0x00; return 2;
+        case '.': col[0] = 0x08;                return 1;
+        case ':': col[0] = 0x0A;                return 1;
+        case '-': col[0] = 0x04; col[1] = 0x04; return 2;
+        default:                                return 0;
+      }
+
+    case TEXT_FONT_PROP:
+    default:
+      return prop_glyph(ch, col);
+  }
+}
+
+// Lays str out column by column; s == NULL only counts
+static uint16_t layout(Text_Strip *s, const char *str, Text_Font font)
+{
+  uint16_t n = 0;
+  for (; *str; ++str) {
+    uint8_t col[GLYPH_MAX_W];
+    uint8_t w = glyph_cols(font, *str, col);
+    if (!w) continue;
+    if (n) {
+      for (uint8_t g = 0; g < TEXT_GAP; ++g, ++n)
+        if (s && n < s->cap) s->cols[n] = 0;
+    }
+    for (uint8_t x = 0; x < w; ++x, ++n)
+      if (s && n < s->cap) s->cols[n] = col[x];
+  }
+  return n;
+}
+
+uint16_t Text_Width(const char *str, Text_Font font)
+{
+  return layout(NULL, str, font);
+}
+
+uint16_t Text_Render(Text_Strip *s, const char *str, Text_Font font)
+{
+  uint16_t n = layout(s, str, font);
+  s->len = (n < s->cap) ? n : s->cap;
+  s->h   = FONT_H[font];
+  return s->len;
+}
+
+void Text_Show(const Text_Strip *s, int16_t x, int8_t r0)
+{
+  int first = (x < 0) ? 0 : x;            // first strip column on screen
+  int c0    = first - x;                  // and the screen column it lands on
+  if (first >= s->len || c0 >= COLS) return;
+
+  int w = s->len - first;
+  if (w > COLS - c0) w = COLS - c0;
+  Mono_BlitCols(r0, (int8_t)c0, s->cols + first, (uint8_t)w, s->h, MONO_OR);
+}
+
+/* -------- Marquee on the anim engine --------
+   The track runs x from -COLS (strip just off the right edge) to len (just
+   off the left); apply() only fires when x moves, so each column step costs
+   one clear, one window copy and one incremental commit. */
+static uint16_t   marquee_cols[TEXT_MARQUEE_COLS];
+static Text_Strip marquee = { marquee_cols, TEXT_MARQUEE_COLS, 0, 0 };
+static int8_t     marquee_r0;
+static uint8_t    marquee_level;
+static bool       marquee_on;
+static void     (*marquee_done)(void);
+
+static void marquee_apply(int16_t x)
+{
+  Mono_Clear();
+  Text_Show(&marquee, x, marquee_r0);
+  Mono_Commit(marquee_level);
+}
+
+static void marquee_finish(void)
+{
+  marquee_on = false;
+  void (*then)(void) = marquee_done;
+  marquee_done = NULL;
+  if (then) then();
+}
+
+static Anim_Track marquee_track = {
+  .ease = ANIM_EASE_LINEAR, .from = -COLS, .to = 0,
+  .apply = marquee_apply, .done = marquee_finish,
+};
+
+bool Text_Marquee(const char *str, Text_Font font, int8_t r0, uint8_t level,
+                  uint16_t cols_per_s, void (*done)(void))
+{
+  Anim_Stop(&marquee_track);
+  Text_Render(&marquee, str, font);
+  marquee_r0    = r0;
+  marquee_level = level;
+  marquee_done  = done;
+  marquee_track.to = (int16_t)marquee.len;
+
+  if (!cols_per_s) cols_per_s = 1;
+  uint32_t ms = ((uint32_t)(marquee.len + COLS) * 1000u) / cols_per_s;
+  marquee_on = Anim_Start(&marquee_track, (uint16_t)(ms > 0xFFFFu ? 0xFFFFu : ms));
+  return marquee_on;
+}
+
+void Text_MarqueeStop(void)
+{
+  Anim_Stop(&marquee_track);
+  marquee_on   = false;
+  marquee_done = NULL;
+}
+
+bool Text_MarqueeBusy(void)
+{
+  return marquee_on;
+}
+
+#ifdef LED_BENCH
+uint32_t Text_BenchScroll(void)
+{
+  Text_Render(&marquee, "18 OCT  12345 STEPS", TEXT_FONT_PROP);
+  marquee_r0    = (int8_t)((ROWS - marquee.h) / 2);
+  marquee_level = 255;
+
+  uint32_t frames = 0;
+  uint32_t t0 = Profile_Cycles();
+  for (int16_t x = -COLS; x <= (int16_t)marquee.len; ++x, ++frames)
+    marquee_apply(x);
+  return (Profile_Cycles() - t0) / frames;
+}
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+#include "main.h"
+#include <stdbool.h>
+
+// Text rendered once into a column strip, then shown through a COLS-wide
+// window. Scrolling only moves the window: no glyph is looked up again.
+// Strip columns hold the glyph rows top-down, bit r = row r of the font.
+
+typedef enum {
+    TEXT_FONT_HEX_3x5 = 0,   // 0-9, A-F; other characters from TEXT_FONT_PROP
+    TEXT_FONT_TINY_4x3,      // 0-9 plus . : - and space, 4 rows high
+    TEXT_FONT_PROP,          // variable width, 5 rows, ' '..'Z' (lower case folded)
+} Text_Font;
+
+typedef struct {
+    uint16_t *cols;          // caller-owned storage
+    uint16_t  cap;           // columns available in cols[]
+    uint16_t  len;           // columns rendered
+    uint8_t   h;             // rows used by the font
+} Text_Strip;
+
+#define TEXT_MARQUEE_COLS  256   // strip owned by Text_Marquee (~60 characters)
+
+uint16_t Text_Render(Text_Strip *s, const char *str, Text_Font font);  // truncates at cap
+uint16_t Text_Width(const char *str, Text_Font font);                  // columns Text_Render needs
+void Text_Show(const Text_Strip *s, int16_t x, int8_t r0);  // OR strip columns x..x+COLS-1 into the mono plane
+
+// Scroll str right to left across rows r0.. on the anim engine: enters at the
+// right edge, leaves at the left, then done() runs. Owns the whole mono plane.
+bool Text_Marquee(const char *str, Text_Font font, int8_t r0, uint8_t level,
+                  uint16_t cols_per_s, void (*done)(void));
+void Text_MarqueeStop(void);
+bool Text_MarqueeBusy(void);
+
+#ifdef LED_BENCH
+uint32_t Text_BenchScroll(void);   // avg CYCCNT per scrolled frame (clear, show, commit)
+#endif
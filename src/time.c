@@ -33,21 +33,16 @@ static uint8_t cur_colon_on = 0xFF;
 // small helpers
 static inline void draw_digit3x5(uint8_t r0, uint8_t c0, int d, uint8_t level)
 {
-  for (uint8_t ry = 0; ry < HEX_H; ++ry) {
-    uint8_t row = (d >= 0 && d <= 9) ? HEX_3x5[d][ry] : 0;
-    for (uint8_t rx = 0; rx < HEX_W; ++rx) {
-      uint8_t bit = (row >> (HEX_W - 1 - rx)) & 1u;
-      Display_SetPixelRC(r0 + ry, c0 + rx, bit ? level : 0);
-    }
-  }
+  if (d >= 0 && d <= 9) Mono_Blit(r0, c0, HEX_3x5[d], HEX_W, HEX_H, MONO_COPY);
+  else                  Mono_Blit(r0, c0, NULL, HEX_W, HEX_H, MONO_ANDNOT);
+  Mono_CommitRect(r0, c0, HEX_W, HEX_H, level);
 }
 
 
 static inline void clear_digit3x5(uint8_t r0, uint8_t c0)
 {
-  for (uint8_t ry = 0; ry < HEX_H; ++ry)
-    for (uint8_t rx = 0; rx < HEX_W; ++rx)
-      Display_SetPixelRC(r0 + ry, c0 + rx, 0);
+  Mono_Blit(r0, c0, NULL, HEX_W, HEX_H, MONO_ANDNOT);
+  Mono_CommitRect(r0, c0, HEX_W, HEX_H, 0);
 }
 
 static inline void draw_colon(uint8_t r0, uint8_t c, uint8_t on, uint8_t level)
@@ -0,0 +1,38 @@
+#pragma once
+// Minimal check/bench helpers for the host tests. A failed CHECK prints
+// where and keeps going; HOST_TEST_END() turns the count into the exit code.
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static int host_failures;
+
+#define CHECK(cond) do {                                                  \
+    if (!(cond)) {                                                        \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);   \
+        host_failures++;                                                  \
+    }                                                                     \
+} while (0)
+
+#define CHECK_EQ(a, b) do {                                               \
+    long long va_ = (long long)(a), vb_ = (long long)(b);                 \
+    if (va_ != vb_) {                                                     \
+        printf("%s:%d: %s == %s failed: %lld != %lld\n",                  \
+               __FILE__, __LINE__, #a, #b, va_, vb_);                     \
+        host_failures++;                                                  \
+    }                                                                     \
+} while (0)
+
+#define HOST_TEST_END() do {                                              \
+    if (host_failures) printf("%d check(s) failed\n", host_failures);     \
+    return host_failures ? 1 : 0;                                         \
+} while (0)
+
+// Wall-clock ns for host benchmarks. DWT->CYCCNT is a plain RAM word here,
+// so Profile_Cycles() reads 0; on target use the -DLED_BENCH prints.
+static inline uint64_t host_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
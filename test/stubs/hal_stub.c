@@ -0,0 +1,33 @@
+#include "stm32l4xx_hal.h"
+
+GPIO_TypeDef   host_gpio[4];
+TIM_TypeDef    host_tim[3];
+LPTIM_TypeDef  host_lptim;
+DWT_Type       host_dwt;
+CoreDebug_Type host_cd;
+ITM_Type       host_itm;
+
+TIM_HandleTypeDef   htim2 = { .Instance = TIM2 };
+LPTIM_HandleTypeDef hlptim1 = { .Instance = LPTIM1 };
+
+uint32_t SystemCoreClock = 16000000u;
+uint32_t host_tick;
+
+uint32_t HAL_GetTick(void) { return host_tick; }
+void HAL_Delay(uint32_t ms) { host_tick += ms; }
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim) { (void)htim; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim) { (void)htim; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_OC_Start_IT(TIM_HandleTypeDef *htim, uint32_t ch) { (void)htim; (void)ch; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_OC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t ch) { (void)htim; (void)ch; return HAL_OK; }
+HAL_StatusTypeDef HAL_LPTIM_PWM_Start_IT(LPTIM_HandleTypeDef *h, uint32_t period, uint32_t pulse)
+{
+    (void)h; (void)period; (void)pulse;
+    return HAL_OK;
+}
+HAL_StatusTypeDef HAL_LPTIM_PWM_Stop_IT(LPTIM_HandleTypeDef *h) { (void)h; return HAL_OK; }
+
+void Error_Handler(void) {}
+
+// app.c is not linked into host tests; the LED driver only pings it
+void App_SetLastTick(void) {}
@@ -0,0 +1,146 @@
+#include "icm_mock.h"
+#include "ICM426xx.h"
+
+SPI_HandleTypeDef hspi1;
+
+uint8_t  icm_regs[ICM_MOCK_BANKS][128];
+uint8_t  icm_bank;
+uint32_t icm_transactions;
+bool     icm_dma_pending;
+
+static uint8_t  fifo[ICM_MOCK_FIFO_BYTES];
+static uint16_t fifo_len, fifo_rd;
+
+// SPI frame state: the first byte after CS falls is R/W + address
+static int  addr = -1;
+static bool reading;
+
+void icm_mock_reset(void)
+{
+    memset(icm_regs, 0, sizeof icm_regs);
+    icm_regs[0][B0_WHO_AM_I] = ICM426xx_ID;
+    icm_bank = 0;
+    icm_transactions = 0;
+    icm_dma_pending = false;
+    fifo_len = fifo_rd = 0;
+    addr = -1;
+}
+
+uint16_t icm_packet3(uint8_t *p, const int16_t a[3], const int16_t g[3], int8_t temp, uint16_t ts)
+{
+    p[0] = 0x68;                           // accel | gyro | ODR timestamp
+    for (int i = 0; i < 3; ++i) {
+        p[1 + 2 * i] = (uint8_t)(a[i] >> 8);
+        p[2 + 2 * i] = (uint8_t)a[i];
+        p[7 + 2 * i] = (uint8_t)(g[i] >> 8);
+        p[8 + 2 * i] = (uint8_t)g[i];
+    }
+    p[13] = (uint8_t)temp;
+    p[14] = (uint8_t)(ts >> 8);
+    p[15] = (uint8_t)ts;
+    return ICM426xx_FIFO_PACKET_LEN;
+}
+
+void icm_fifo_push(const uint8_t *bytes, uint16_t len)
+{
+    if (fifo_rd) {                         // compact what was popped
+        memmove(fifo, fifo + fifo_rd, fifo_len - fifo_rd);
+        fifo_len -= fifo_rd;
+        fifo_rd = 0;
+    }
+    if (len > ICM_MOCK_FIFO_BYTES - fifo_len) len = ICM_MOCK_FIFO_BYTES - fifo_len;
+    memcpy(fifo + fifo_len, bytes, len);
+    fifo_len += len;
+}
+
+uint16_t icm_fifo_bytes(void)
+{
+    return fifo_len - fifo_rd;
+}
+
+static uint8_t reg_read(uint8_t reg)
+{
+    if (icm_bank == 0) {
+        uint16_t count = icm_fifo_bytes();
+        if (icm_regs[0][B0_INTF_CONFIG0] & 0x40) count /= ICM426xx_FIFO_PACKET_LEN;
+        switch (reg) {
+        case B0_FIFO_DATA:   return fifo_rd < fifo_len ? fifo[fifo_rd++] : 0xFF;
+        case B0_FIFO_COUNTH: return (uint8_t)(count >> 8);
+        case B0_FIFO_COUNTL: return (uint8_t)count;
+        }
+    }
+    return icm_regs[icm_bank][reg];
+}
+
+static void reg_write(uint8_t reg, uint8_t val)
+{
+    if (reg == B0_REG_BANK_SEL) {          // present in every bank
+        icm_bank = val & 7u;
+        if (icm_bank >= ICM_MOCK_BANKS) icm_bank = 0;
+        return;
+    }
+    icm_regs[icm_bank][reg] = val;
+    if (icm_bank == 0 && reg == B0_SIGNAL_PATH_RESET && (val & 0x02)) fifo_len = fifo_rd = 0;
+    if (icm_bank == 0 && reg == B0_DEVICE_CONFIG && (val & 0x01)) icm_bank = 0;
+}
+
+static uint8_t xfer(uint8_t mosi)
+{
+    if (addr < 0) {
+        addr = mosi & 0x7F;
+        reading = mosi & 0x80;
+        return 0;
+    }
+    uint8_t miso = 0;
+    if (reading) miso = reg_read((uint8_t)addr);
+    else         reg_write((uint8_t)addr, mosi);
+    if (!(icm_bank == 0 && addr == B0_FIFO_DATA)) addr = (addr + 1) & 0x7F;
+    return miso;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    port->BSRR = state == GPIO_PIN_SET ? pin : (uint32_t)pin << 16;
+    if (port == ICM426xx_SPI_CS_PIN_PORT && pin == ICM426xx_SPI_CS_PIN_NUMBER && state == GPIO_PIN_RESET) {
+        addr = -1;
+        icm_transactions++;
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *h, uint8_t *tx, uint8_t *rx, uint16_t n, uint32_t timeout)
+{
+    (void)h; (void)timeout;
+    for (uint16_t i = 0; i < n; ++i) {
+        uint8_t v = xfer(tx[i]);
+        if (rx) rx[i] = v;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *d, uint16_t n, uint32_t timeout)
+{
+    return HAL_SPI_TransmitReceive(h, d, NULL, n, timeout);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *h, uint8_t *d, uint16_t n, uint32_t timeout)
+{
+    (void)h; (void)timeout;
+    for (uint16_t i = 0; i < n; ++i) d[i] = xfer(0);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *h, uint8_t *tx, uint8_t *rx, uint16_t n)
+{
+    if (icm_dma_pending) return HAL_BUSY;
+    HAL_SPI_TransmitReceive(h, tx, rx, n, 0);
+    icm_dma_pending = true;
+    return HAL_OK;
+}
+
+bool icm_mock_dma_complete(bool ok)
+{
+    if (!icm_dma_pending) return false;
+    icm_dma_pending = false;
+    ICM426xx_SpiComplete(&hspi1, ok);
+    return true;
+}
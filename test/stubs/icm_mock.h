@@ -0,0 +1,26 @@
+#pragma once
+// ICM426xx register file behind the HAL SPI calls, for tests that link
+// icm_mock.c. Five user banks switched through REG_BANK_SEL; FIFO_DATA pops
+// a byte FIFO without advancing the address, FIFO_COUNT reads records or
+// bytes as INTF_CONFIG0 asks, and SIGNAL_PATH_RESET.FIFO_FLUSH empties it.
+// DMA transfers move their bytes at once but only complete when the test
+// calls icm_mock_dma_complete().
+#include "stm32l4xx_hal.h"
+#include <stdbool.h>
+
+#define ICM_MOCK_BANKS       5
+#define ICM_MOCK_FIFO_BYTES  2048
+
+extern uint8_t  icm_regs[ICM_MOCK_BANKS][128];
+extern uint8_t  icm_bank;               // REG_BANK_SEL as the sensor sees it
+extern uint32_t icm_transactions;       // CS-low frames, blocking and DMA
+extern bool     icm_dma_pending;
+
+void icm_mock_reset(void);              // registers, FIFO and counters to zero
+
+// Packet 3: header 0x68, accel, gyro (big endian), temp, 16-bit timestamp
+uint16_t icm_packet3(uint8_t *p, const int16_t a[3], const int16_t g[3], int8_t temp, uint16_t ts);
+void     icm_fifo_push(const uint8_t *bytes, uint16_t len);
+uint16_t icm_fifo_bytes(void);          // still to be popped
+
+bool icm_mock_dma_complete(bool ok);    // ICM426xx_SpiComplete for the pending transfer
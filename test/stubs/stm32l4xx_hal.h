@@ -0,0 +1,107 @@
+#pragma once
+// Host stand-in for the Cube HAL: just the types, registers and calls the
+// firmware modules under test touch. Peripherals are plain structs in RAM
+// (hal_stub.c) so tests can poke TIM2->CNT or read GPIO BSRR back.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define __IO volatile
+
+typedef struct { volatile uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2], BRR; } GPIO_TypeDef;
+typedef struct { volatile uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR, RCR,
+                 CCR1, CCR2, CCR3, CCR4; } TIM_TypeDef;
+typedef struct { volatile uint32_t ISR, ICR, IER, CFGR, CR, CMP, ARR, CNT, OR; } LPTIM_TypeDef;
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+typedef struct { volatile uint32_t TER, TCR; union { volatile uint32_t u32; volatile uint8_t u8; } PORT[32]; } ITM_Type;
+
+extern GPIO_TypeDef   host_gpio[4];
+extern TIM_TypeDef    host_tim[3];
+extern LPTIM_TypeDef  host_lptim;
+extern DWT_Type       host_dwt;
+extern CoreDebug_Type host_cd;
+extern ITM_Type       host_itm;
+
+#define GPIOA      (&host_gpio[0])
+#define GPIOB      (&host_gpio[1])
+#define GPIOC      (&host_gpio[2])
+#define GPIOH      (&host_gpio[3])
+#define TIM2       (&host_tim[0])
+#define TIM6       (&host_tim[1])
+#define TIM7       (&host_tim[2])
+#define LPTIM1     (&host_lptim)
+#define DWT        (&host_dwt)
+#define CoreDebug  (&host_cd)
+#define ITM        (&host_itm)
+
+#define DWT_CTRL_CYCCNTENA_Msk      1u
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+
+#define GPIO_PIN_0   0x0001u
+#define GPIO_PIN_1   0x0002u
+#define GPIO_PIN_2   0x0004u
+#define GPIO_PIN_3   0x0008u
+#define GPIO_PIN_4   0x0010u
+#define GPIO_PIN_5   0x0020u
+#define GPIO_PIN_6   0x0040u
+#define GPIO_PIN_7   0x0080u
+#define GPIO_PIN_8   0x0100u
+#define GPIO_PIN_9   0x0200u
+#define GPIO_PIN_10  0x0400u
+#define GPIO_PIN_11  0x0800u
+#define GPIO_PIN_12  0x1000u
+#define GPIO_PIN_13  0x2000u
+#define GPIO_PIN_14  0x4000u
+#define GPIO_PIN_15  0x8000u
+
+typedef enum { HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET, GPIO_PIN_SET } GPIO_PinState;
+typedef enum { HAL_TIM_ACTIVE_CHANNEL_1 = 1 } HAL_TIM_ActiveChannel;
+typedef int IRQn_Type;
+#define EXTI0_IRQn  6
+#define EXTI3_IRQn  9
+
+typedef struct { uint32_t Prescaler, CounterMode, Period, ClockDivision, AutoReloadPreload; } TIM_Base_InitTypeDef;
+typedef struct { TIM_TypeDef *Instance; TIM_Base_InitTypeDef Init; HAL_TIM_ActiveChannel Channel; } TIM_HandleTypeDef;
+typedef struct { LPTIM_TypeDef *Instance; } LPTIM_HandleTypeDef;
+typedef struct { uint32_t Mode; } SPI_InitTypeDef;
+typedef struct { void *Instance; SPI_InitTypeDef Init; void *hdmarx, *hdmatx; } SPI_HandleTypeDef;
+
+#define TIM_CHANNEL_1  0
+#define HAL_MAX_DELAY  0xFFFFFFFFu
+
+#define __HAL_TIM_GET_AUTORELOAD(h)     ((h)->Instance->ARR)
+#define __HAL_TIM_SET_AUTORELOAD(h, v)  ((h)->Instance->ARR = (v))
+#define __HAL_TIM_GET_COUNTER(h)        ((h)->Instance->CNT)
+#define __HAL_TIM_SET_COMPARE(h, ch, v) ((h)->Instance->CCR1 = (v))
+
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __WFI(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t x) { (void)x; }
+static inline uint32_t ITM_SendChar(uint32_t c) { return c; }
+
+extern uint32_t SystemCoreClock;
+extern uint32_t host_tick;               // HAL_GetTick() value; HAL_Delay() adds to it
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_OC_Start_IT(TIM_HandleTypeDef *htim, uint32_t ch);
+HAL_StatusTypeDef HAL_TIM_OC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t ch);
+HAL_StatusTypeDef HAL_LPTIM_PWM_Start_IT(LPTIM_HandleTypeDef *h, uint32_t period, uint32_t pulse);
+HAL_StatusTypeDef HAL_LPTIM_PWM_Stop_IT(LPTIM_HandleTypeDef *h);
+
+// SPI is served by icm_mock.c, for the tests that link it
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *d, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *h, uint8_t *d, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *h, uint8_t *tx, uint8_t *rx, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *h, uint8_t *tx, uint8_t *rx, uint16_t n);
@@ -0,0 +1,113 @@
+// LED current limiter: the cap must engage and lift within one frame of the
+// framebuffer change, and hold the driven CCR to the budget while it is on.
+#include "led_driver.c"
+#include "host_test.h"
+
+#define TEST_ARR   1199u
+#define BUDGET_UA  1500u
+
+// CCR the budget allows for a full-level pixel (ON time is capped at TEST_ARR/2)
+static uint32_t capped_ccr(void)
+{
+    return (uint32_t)(((uint64_t)(TEST_ARR + 1u) * BUDGET_UA) / LED_PIXEL_UA) + 1u;   // +1: dither
+}
+
+static void run_frames(int n)
+{
+    for (int f = 0; f < n; ++f) {
+        uint16_t len = act_len ? act_len : 1;
+        for (uint16_t s = 0; s < len; ++s) Led_ScanSlotStart();
+    }
+}
+
+// slots until the limiter state equals want, or -1
+static int slots_until_limited(bool want, int max)
+{
+    for (int n = 1; n <= max; ++n) {
+        Led_ScanSlotStart();
+        if (Led_CurrentLimited() == want) return n;
+    }
+    return -1;
+}
+
+static void dim_pattern(void)
+{
+    Display_Clear();
+    Display_SetRegion(5, 5, 5, 5, 100);      // ~4 % duty: far under the budget
+}
+
+static void test_engages_within_one_frame(void)
+{
+    dim_pattern();
+    run_frames(3);
+    CHECK(!Led_CurrentLimited());
+    CHECK(Led_CurrentEstimate_uA() < BUDGET_UA);
+
+    // half-way through a frame, the whole board goes to full level; the pass
+    // in progress now runs over the longer list, then the next one is capped
+    for (int s = 0; s < act_len / 2; ++s) Led_ScanSlotStart();
+    Display_SetRegion(0, 0, COLS, ROWS, 255);
+    uint16_t frame_len = act_len;
+    int n = slots_until_limited(true, 4 * N_PIXELS);
+    CHECK(n > 0);
+    CHECK(n <= frame_len);                   // at the next frame start, not later
+    CHECK(Led_CurrentEstimate_uA() <= BUDGET_UA);
+
+    // the whole frame after the cap is driven at the capped CCR or below
+    uint32_t worst = 0;
+    for (uint16_t s = 0; s < act_len; ++s) {
+        Led_ScanSlotStart();
+        if (TIM2->CCR1 > worst) worst = TIM2->CCR1;
+    }
+    CHECK(worst <= capped_ccr());
+    CHECK(worst + 8u >= capped_ccr());       // capped, not blanked
+}
+
+static void test_lifts_within_one_frame(void)
+{
+    Display_SetRegion(0, 0, COLS, ROWS, 255);
+    run_frames(2);
+    CHECK(Led_CurrentLimited());
+
+    uint16_t frame_len = act_len;
+    for (int s = 0; s < 10; ++s) Led_ScanSlotStart();
+    dim_pattern();                           // shorter list: scan_pos wraps early
+    int n = slots_until_limited(false, 4 * N_PIXELS);
+    CHECK(n > 0);
+    CHECK(n <= frame_len);
+    CHECK(Led_CurrentEstimate_uA() < BUDGET_UA);
+}
+
+static void test_all_on_next_slot(void)
+{
+    dim_pattern();
+    run_frames(2);
+    Led_AllOn(255);                          // restarts the pass, so the cap is due at once
+    CHECK_EQ(slots_until_limited(true, 1), 1);
+    CHECK(TIM2->CCR1 <= capped_ccr());
+}
+
+static void test_no_budget_no_cap(void)
+{
+    Led_SetCurrentBudget(0);
+    Display_SetRegion(0, 0, COLS, ROWS, 255);
+    run_frames(2);
+    CHECK(!Led_CurrentLimited());
+    CHECK(Led_CurrentEstimate_uA() > BUDGET_UA);
+    Led_SetCurrentBudget(BUDGET_UA);
+}
+
+int main(void)
+{
+    htim2.Instance->ARR = TEST_ARR;
+    Led_Init();
+    Led_SetGlobalBrightness(255);
+    Led_SetCurrentBudget(BUDGET_UA);
+    run_frames(1);                           // adopt the brightness table
+
+    test_engages_within_one_frame();
+    test_lifts_within_one_frame();
+    test_all_on_next_slot();
+    test_no_budget_no_cap();
+    HOST_TEST_END();
+}
@@ -0,0 +1,68 @@
+// Fade completion hooks: a finished fade's done() must run exactly once,
+// even when the next fade or brightness change comes before Led_FadePoll.
+#include "led_driver.c"
+#include "host_test.h"
+
+static int hook_a, hook_b;
+static void on_a(void) { hook_a++; }
+static void on_b(void) { hook_b++; }
+
+// run scan slots until the ISR has finished the fade (or give up)
+static void run_until_fade_end(void)
+{
+    for (int i = 0; i < 200000 && !fade_end; ++i) Led_ScanSlotStart();
+}
+
+static void test_hook_survives_refade(void)
+{
+    hook_a = hook_b = 0;
+    Led_FadeTo(40, 20, ANIM_EASE_LINEAR, on_a);
+    run_until_fade_end();
+    CHECK(fade_end);
+    CHECK_EQ(hook_a, 0);                   // not polled yet
+
+    Led_FadeTo(200, 20, ANIM_EASE_LINEAR, on_b);
+    CHECK_EQ(hook_a, 1);
+    run_until_fade_end();
+    Led_FadePoll();
+    CHECK_EQ(hook_b, 1);
+    Led_FadePoll();
+    CHECK_EQ(hook_a, 1);
+    CHECK_EQ(hook_b, 1);
+}
+
+static void test_hook_survives_set_brightness(void)
+{
+    hook_a = 0;
+    Led_FadeTo(10, 20, ANIM_EASE_LINEAR, on_a);
+    run_until_fade_end();
+    Led_SetGlobalBrightness(128);
+    CHECK_EQ(hook_a, 1);
+    Led_FadePoll();
+    CHECK_EQ(hook_a, 1);
+}
+
+static void test_superseded_fade_drops_hook(void)
+{
+    hook_a = hook_b = 0;
+    Led_FadeTo(10, 500, ANIM_EASE_LINEAR, on_a);
+    for (int i = 0; i < 100; ++i) Led_ScanSlotStart();
+    CHECK(!fade_end);
+    Led_FadeTo(90, 20, ANIM_EASE_LINEAR, on_b);
+    run_until_fade_end();
+    Led_FadePoll();
+    CHECK_EQ(hook_a, 0);
+    CHECK_EQ(hook_b, 1);
+}
+
+int main(void)
+{
+    htim2.Instance->ARR = 1199;
+    Led_Init();
+    Led_DrawClock(12, 34, 56);
+
+    test_hook_survives_refade();
+    test_hook_survives_set_brightness();
+    test_superseded_fade_drops_hook();
+    HOST_TEST_END();
+}
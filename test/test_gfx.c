@@ -0,0 +1,241 @@
+// Q8 primitives against a naive float rendering of the same coverage model:
+// Wu lines, filled circles and 1 px arcs, on and off the board, plus a host
+// benchmark of the fixed-point spinner scene against gfx.c's float baseline.
+#include "led_driver.c"
+#define LED_BENCH                   // for the float baseline in gfx.c
+#include "gfx.c"
+#include "host_test.h"
+
+#define TWO_PI  6.28318530718f
+#define COV_TOL 3                   // Q8 steps: isqrt floors, Wu's ca/cb floor
+
+static float ref[N_PIXELS];         // max-blended float coverage, 0..1
+static int worst_dev;
+
+static void ref_clear(void)
+{
+    for (int i = 0; i < N_PIXELS; ++i) ref[i] = 0.0f;
+}
+
+static void ref_plot(int x, int y, float cov)
+{
+    if (x < 0 || x >= COLS || y < 0 || y >= ROWS || !VALID_MASK[y * COLS + x]) return;
+    if (cov > ref[y * COLS + x]) ref[y * COLS + x] = cov;
+}
+
+// The level plot() writes for a Q8 coverage
+static int level_of(int cov, uint8_t level)
+{
+    if (cov <= 0) return 0;
+    if (cov > 255) cov = 255;
+    return (level * (LED_AA_LEVEL[cov] + 1)) >> 8;
+}
+
+// fb must hold the level of the reference coverage, give or take COV_TOL
+static void compare(const char *what, const uint8_t *skip)
+{
+    int bad = 0;
+    for (int i = 0; i < N_PIXELS; ++i) {
+        if (skip && skip[i]) continue;
+        int c  = (int)lroundf(ref[i] * 256.0f);
+        int lo = level_of(c - COV_TOL, 255), hi = level_of(c + COV_TOL, 255);
+        if (fb[i] < lo || fb[i] > hi) {
+            if (!bad++) printf("%s: pixel %d level %d, want %d..%d\n", what, i, fb[i], lo, hi);
+        }
+        for (int d = 0; d <= 16; ++d)
+            if (level_of(c - d, 255) <= fb[i] && fb[i] <= level_of(c + d, 255)) {
+                if (d > worst_dev) worst_dev = d;
+                break;
+            }
+    }
+    CHECK_EQ(bad, 0);
+}
+
+// Wu in float: per major-axis pixel, the span of the line inside it split
+// between the two minor-axis cells by the fractional crossing
+static void ref_line(float x0, float y0, float x1, float y1)
+{
+    bool steep = fabsf(y1 - y0) > fabsf(x1 - x0);
+    float t;
+    if (steep)   { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+    float dx = x1 - x0, grad = dx > 0.0f ? (y1 - y0) / dx : 0.0f;
+
+    for (int p = (int)floorf(x0 + 0.5f); p <= (int)floorf(x1 + 0.5f); ++p) {
+        float lo = fmaxf(p - 0.5f, x0), hi = fminf(p + 0.5f, x1);
+        float span = dx > 0.0f ? hi - lo : 1.0f;
+        if (span <= 0.0f) continue;
+        float y = y0 + (p - x0) * grad;
+        int yi = (int)floorf(y);
+        float f = y - yi;
+        if (steep) { ref_plot(yi, p, span * (1 - f)); ref_plot(yi + 1, p, span * f); }
+        else       { ref_plot(p, yi, span * (1 - f)); ref_plot(p, yi + 1, span * f); }
+    }
+}
+
+static void ref_fill(float cx, float cy, float r)
+{
+    for (int y = 0; y < ROWS; ++y)
+        for (int x = 0; x < COLS; ++x) {
+            float d = hypotf(x - cx, y - cy);
+            ref_plot(x, y, fminf(r + 0.5f - d, 1.0f));
+        }
+}
+
+// angle of a cell from the centre: 0 = 12 o'clock, clockwise, 0..2π
+static float cell_angle(int x, int y, float cx, float cy)
+{
+    float a = atan2f(x - cx, cy - y);
+    return a < 0.0f ? a + TWO_PI : a;
+}
+
+static bool in_sweep(float a, float a0, float sweep)
+{
+    float rel = a - a0;
+    if (rel < 0.0f) rel += TWO_PI;
+    return rel <= sweep;
+}
+
+// Cells within a hair of either end are left out of the compare: the fixed
+// version decides them on a Q15 sin table, the float one on atan2f.
+static void ref_arc(float cx, float cy, float r, float a0, float sweep, uint8_t *skip)
+{
+    for (int y = 0; y < ROWS; ++y)
+        for (int x = 0; x < COLS; ++x) {
+            float a = cell_angle(x, y, cx, cy);
+            float e0 = fabsf(a - a0), e1 = fabsf(a - fmodf(a0 + sweep, TWO_PI));
+            if (sweep < TWO_PI * 0.999f &&
+                (fminf(e0, TWO_PI - e0) < 0.01f || fminf(e1, TWO_PI - e1) < 0.01f)) {
+                skip[y * COLS + x] = 1;
+                continue;
+            }
+            if (!in_sweep(a, a0, sweep)) continue;
+            ref_plot(x, y, 1.0f - fabsf(hypotf(x - cx, y - cy) - r));
+        }
+}
+
+static float q8f(int16_t v) { return v / 256.0f; }
+
+// small LCG so the shapes are the same on every host
+static uint32_t rng = 12345u;
+static int rnd(int lo, int hi)
+{
+    rng = rng * 1103515245u + 12345u;
+    return lo + (int)((rng >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+static void test_sin(void)
+{
+    int worst = 0;
+    for (uint32_t a = 0; a < 65536u; a += 7u) {
+        int ds = abs(Gfx_Sin((uint16_t)a) - (int)lroundf(32767.0f * sinf(a * TWO_PI / 65536.0f)));
+        int dc = abs(Gfx_Cos((uint16_t)a) - (int)lroundf(32767.0f * cosf(a * TWO_PI / 65536.0f)));
+        if (ds > worst) worst = ds;
+        if (dc > worst) worst = dc;
+    }
+    CHECK(worst <= 4);
+    CHECK_EQ(Gfx_Sin(0), 0);
+    CHECK_EQ(Gfx_Sin(0x4000), 32767);
+    CHECK_EQ(Gfx_Sin(0xC000), -32767);
+    for (uint32_t v = 0; v < 70000u; v += 13u) CHECK_EQ(isqrt32(v), (uint32_t)sqrt((double)v));
+    CHECK_EQ(isqrt32(0xFFFFFFFFu), 65535u);
+}
+
+static void test_lines(void)
+{
+    for (int k = 0; k < 400; ++k) {
+        // mostly on the board, some running off every edge
+        int16_t x0 = (int16_t)rnd(-3 * 256, (COLS + 2) * 256), y0 = (int16_t)rnd(-3 * 256, (ROWS + 2) * 256);
+        int16_t x1 = (int16_t)rnd(-3 * 256, (COLS + 2) * 256), y1 = (int16_t)rnd(-3 * 256, (ROWS + 2) * 256);
+        if (k < 8) { y1 = y0; x1 = (int16_t)(x0 + k * 200); }               // flat, incl. a dot
+        Display_Clear();
+        ref_clear();
+        Gfx_Line(x0, y0, x1, y1, 255);
+        ref_line(q8f(x0), q8f(y0), q8f(x1), q8f(y1));
+        compare("line", NULL);
+    }
+}
+
+static void test_circles(void)
+{
+    for (int k = 0; k < 200; ++k) {
+        int16_t cx = (int16_t)rnd(-2 * 256, (COLS + 1) * 256), cy = (int16_t)rnd(-2 * 256, (ROWS + 1) * 256);
+        int16_t r  = (int16_t)rnd(64, 9 * 256);
+        Display_Clear();
+        ref_clear();
+        Gfx_FillCircle(cx, cy, r, 255);
+        ref_fill(q8f(cx), q8f(cy), q8f(r));
+        compare("fill", NULL);
+    }
+    Display_Clear();
+    Gfx_FillCircle(GFX_PX(7), GFX_PX(7), 0, 255);
+    for (int i = 0; i < N_PIXELS; ++i) CHECK_EQ(fb[i], 0);
+}
+
+static void test_arcs(void)
+{
+    static uint8_t skip[N_PIXELS];
+    for (int k = 0; k < 200; ++k) {
+        int16_t cx = (int16_t)rnd(2 * 256, (COLS - 2) * 256), cy = (int16_t)rnd(2 * 256, (ROWS - 2) * 256);
+        int16_t r  = (int16_t)rnd(2 * 256, 8 * 256);
+        uint16_t start = (uint16_t)rnd(0, 0xFFFF);
+        uint16_t sweep = k < 10 ? GFX_FULL_TURN : (uint16_t)rnd(0x0800, 0xF800);   // narrow and wide
+        Display_Clear();
+        ref_clear();
+        for (int i = 0; i < N_PIXELS; ++i) skip[i] = 0;
+        Gfx_Arc(cx, cy, r, start, sweep, 255);
+        ref_arc(q8f(cx), q8f(cy), q8f(r), start * TWO_PI / 65536.0f,
+                sweep == GFX_FULL_TURN ? TWO_PI : sweep * TWO_PI / 65536.0f, skip);
+        compare("arc", skip);
+    }
+    Display_Clear();
+    Gfx_Arc(GFX_PX(7), GFX_PX(7), GFX_PX(4), 0x1000, 0, 255);
+    for (int i = 0; i < N_PIXELS; ++i) CHECK_EQ(fb[i], 0);
+}
+
+// The scene Gfx_Bench draws: 12 spokes, a centre dot and a 3/4 ring
+static void bench_scene(void)
+{
+    const float c = (COLS - 1) / 2.0f, m = (ROWS - 1) / 2.0f;
+    enum { REPS = 2000 };
+
+    uint64_t t0 = host_ns();
+    for (int k = 0; k < REPS; ++k) {
+        Display_Clear();
+        for (uint16_t i = 0; i < 12; ++i) {
+            uint16_t a = (uint16_t)(i * (65536u / 12u));
+            Gfx_Line((int16_t)(c * 256), (int16_t)(m * 256),
+                     (int16_t)(c * 256 + ((Gfx_Sin(a) * 5) >> 7)),
+                     (int16_t)(m * 256 - ((Gfx_Cos(a) * 5) >> 7)), 255);
+        }
+        Gfx_FillCircle((int16_t)(c * 256), (int16_t)(m * 256), GFX_PX(2), 255);
+        Gfx_Arc((int16_t)(c * 256), (int16_t)(m * 256), GFX_PX(6), 0, 0xC000u, 255);
+    }
+    uint64_t t1 = host_ns();
+    for (int k = 0; k < REPS; ++k) {
+        Display_Clear();
+        for (int i = 0; i < 12; ++i) {
+            float a = i * TWO_PI / 12.0f;
+            float_line(c, m, c + 5.0f * sinf(a), m - 5.0f * cosf(a), 255);
+        }
+        float_circle(c, m, 2.0f, 255);
+        float_arc(c, m, 6.0f, 0.0f, 4.712389f, 255);
+    }
+    uint64_t t2 = host_ns();
+
+    printf("gfx scene: fixed %.0f ns, float %.0f ns per frame; worst coverage deviation %d/256\n",
+           (double)(t1 - t0) / REPS, (double)(t2 - t1) / REPS, worst_dev);
+}
+
+int main(void)
+{
+    htim2.Instance->ARR = 1199;
+    Led_Init();
+
+    test_sin();
+    test_lines();
+    test_circles();
+    test_arcs();
+    bench_scene();
+    HOST_TEST_END();
+}
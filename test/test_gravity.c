@@ -0,0 +1,164 @@
+// ICM426xx_GravityUpdate over a wrist trace (traces/gravity_wrist.csv, see
+// gen_gravity_trace.py): the estimate must stay unit length, follow tilts
+// without lag, ride out shakes and knocks far better than the raw accel
+// direction, and match the float reference.
+#include "ICM426xx.c"
+#include "host_test.h"
+#include <stdlib.h>
+
+#define MAX_ROWS   4096
+#define MAX_LAG    40                       // samples tried when looking for lag
+
+typedef enum { SEG_REST, SEG_TILT, SEG_SHAKE, SEG_TILT_SHAKE, SEG_N } Seg;
+static const char *const SEG_NAME[SEG_N] = { "rest", "tilt", "shake", "tilt+shake" };
+
+typedef struct {
+    ICM426xx_SampleRaw r;
+    double v[3];                            // true gravity direction, sensor axes
+    Seg seg;
+} Row;
+
+static Row rows[MAX_ROWS];
+static int n_rows;
+static double fused[MAX_ROWS][3], fused_f[MAX_ROWS][3], accel[MAX_ROWS][3];
+
+static void load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) { printf("cannot open %s\n", path); exit(1); }
+    char line[256], label[32];
+    while (fgets(line, sizeof line, f) && n_rows < MAX_ROWS) {
+        Row *w = &rows[n_rows];
+        int ax, ay, az, gx, gy, gz;
+        unsigned long t;
+        if (sscanf(line, "%lu,%d,%d,%d,%d,%d,%d,%lf,%lf,%lf,%31s", &t, &ax, &ay, &az, &gx, &gy, &gz,
+                   &w->v[0], &w->v[1], &w->v[2], label) != 11)
+            continue;                       // comment or header
+        w->r = (ICM426xx_SampleRaw){ (int16_t)ax, (int16_t)ay, (int16_t)az, (int16_t)gx, (int16_t)gy,
+                                     (int16_t)gz, ICM426xx_ACCEL_FSR_G, ICM426xx_GYRO_FSR_DPS, (uint32_t)t };
+        w->seg = SEG_N;
+        for (int s = 0; s < SEG_N; ++s)
+            if (!strcmp(label, SEG_NAME[s])) w->seg = (Seg)s;
+        CHECK(w->seg != SEG_N);
+        n_rows++;
+    }
+    fclose(f);
+}
+
+static double norm3(const double *a) { return sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]); }
+
+static double angle_deg(const double *a, const double *b)
+{
+    double c = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) / (norm3(a) * norm3(b));
+    return acos(c > 1.0 ? 1.0 : (c < -1.0 ? -1.0 : c)) * (180.0 / M_PI);
+}
+
+// Both filters over the trace, with dt from the sensor timestamps as the app does
+static double run(void)
+{
+    ICM426xx_Gravity  g  = { 0 };
+    ICM426xx_GravityF gf = { 0 };
+    double worst_norm = 0.0;
+
+    for (int i = 0; i < n_rows; ++i) {
+        const ICM426xx_SampleRaw *r = &rows[i].r;
+        uint32_t dt = i ? r->ts - rows[i - 1].r.ts : 0;
+        ICM426xx_Sample s;
+        ICM426xx_RawToSample(r, &s);
+        ICM426xx_GravityUpdate(&g, r, dt);
+        ICM426xx_GravityUpdateF(&gf, &s, dt);
+
+        fused[i][0] = (double)g.x / ICM426xx_GRAVITY_ONE;
+        fused[i][1] = (double)g.y / ICM426xx_GRAVITY_ONE;
+        fused[i][2] = (double)g.z / ICM426xx_GRAVITY_ONE;
+        fused_f[i][0] = gf.x; fused_f[i][1] = gf.y; fused_f[i][2] = gf.z;
+        accel[i][0] = r->ax; accel[i][1] = r->ay; accel[i][2] = r->az;
+
+        double dn = fabs(norm3(fused[i]) - 1.0);
+        if (dn > worst_norm) worst_norm = dn;
+    }
+    return worst_norm;
+}
+
+typedef struct { double rms, max; int n; } ErrStat;
+
+// Error of est against the truth shifted by lag samples, over one kind of segment
+static ErrStat seg_error(double (*est)[3], Seg seg, int lag)
+{
+    ErrStat e = { 0.0, 0.0, 0 };
+    for (int i = MAX_LAG; i < n_rows; ++i) {
+        if (rows[i].seg != seg) continue;
+        double d = angle_deg(est[i], rows[i - lag].v);
+        e.rms += d * d;
+        if (d > e.max) e.max = d;
+        e.n++;
+    }
+    e.rms = e.n ? sqrt(e.rms / e.n) : 0.0;
+    return e;
+}
+
+// Shift of the truth that best explains how est moves during the tilts, in
+// samples: 50 ms changes are compared, so a steady offset does not count
+#define LAG_SPAN 10
+
+static int lag_samples(double (*est)[3])
+{
+    int best = 0;
+    double best_e = 1e30;
+    for (int k = 0; k < MAX_LAG; ++k) {
+        double e = 0.0;
+        for (int i = MAX_LAG + LAG_SPAN; i < n_rows; ++i) {
+            if (rows[i].seg != SEG_TILT) continue;
+            double n0 = norm3(est[i]), n1 = norm3(est[i - LAG_SPAN]);
+            for (int c = 0; c < 3; ++c) {
+                double d = (est[i][c] / n0 - est[i - LAG_SPAN][c] / n1) -
+                           (rows[i - k].v[c] - rows[i - k - LAG_SPAN].v[c]);
+                e += d * d;
+            }
+        }
+        if (e < best_e) { best_e = e; best = k; }
+    }
+    return best;
+}
+
+int main(void)
+{
+    load(GRAVITY_TRACE);
+    CHECK(n_rows > 1000);
+
+    double worst_norm = run();
+    CHECK(worst_norm < 1e-4);                               // |v| = 1 every sample
+
+    double ff = 0.0;                                        // Q28 against float
+    for (int i = 0; i < n_rows; ++i) {
+        double d = angle_deg(fused[i], fused_f[i]);
+        if (d > ff) ff = d;
+    }
+    CHECK(ff < 0.05);
+
+    int lag_f = lag_samples(fused), lag_a = lag_samples(accel);
+    printf("trace: %d samples, max ||v|-1| %.1e, max |Q28-float| %.3f deg\n", n_rows, worst_norm, ff);
+    printf("lag over the tilts: fused %d ms, accel %d ms\n", lag_f * 5, lag_a * 5);
+    printf("%-11s %15s %15s\n", "deg", "fused rms/max", "accel rms/max");
+
+    ErrStat ef[SEG_N], ea[SEG_N];
+    for (int s = 0; s < SEG_N; ++s) {
+        ef[s] = seg_error(fused, (Seg)s, 0);
+        ea[s] = seg_error(accel, (Seg)s, 0);
+        CHECK(ef[s].n > 0);
+        printf("%-11s %7.2f %7.2f %7.2f %7.2f\n", SEG_NAME[s], ef[s].rms, ef[s].max, ea[s].rms, ea[s].max);
+    }
+
+    CHECK(lag_f <= 1);                                      // ≤ 5 ms behind a 200 dps tilt
+    CHECK(ef[SEG_TILT].max < 2.0);
+    // a 1 dps gyro bias costs about a degree until the integral term has it
+    CHECK(ef[SEG_REST].max < 6.0);
+    CHECK(ef[SEG_REST].rms < 2.5);
+    // shakes and knocks: the wobble the raw accel shows is mostly gone; what
+    // is left is sideways shake that keeps |a| inside the gate
+    CHECK(ef[SEG_SHAKE].max < 8.0);
+    CHECK(ef[SEG_SHAKE].rms * 3.0 < ea[SEG_SHAKE].rms);
+    CHECK(ef[SEG_TILT_SHAKE].max < 5.0);
+    CHECK(ef[SEG_TILT_SHAKE].rms * 4.0 < ea[SEG_TILT_SHAKE].rms);
+    HOST_TEST_END();
+}
@@ -0,0 +1,297 @@
+// ICM426xx FIFO: packet 3 parsing, the packet 4 timestamp, the stop
+// conditions (empty or invalid header, truncated tail), 16-bit timestamp
+// unwrap, the watermark and record count round trip through the mock
+// register file, blocking and DMA, the sample stream's timestamps against
+// when it is serviced, and the start-up samples a profile switch must not
+// hand out.
+#include "ICM426xx.c"
+#include "icm_mock.h"
+#include "host_test.h"
+
+static const int16_t A[3] = { 16384, -8192, 123 };
+static const int16_t G[3] = { -32768, 32767, -1 };
+
+static void bring_up(void)
+{
+    icm_mock_reset();
+    ICM426xx_InitStart();
+    while (!ICM426xx_InitStep()) host_tick++;
+}
+
+static void test_packet3_layout(void)
+{
+    uint8_t p[ICM426xx_FIFO_PACKET_LEN];
+    CHECK_EQ(icm_packet3(p, A, G, 25, 0x1234), 16);
+    CHECK_EQ(p[0], 0x68);
+    CHECK(p[1] == 0x40 && p[2] == 0x00);                 // accel X, big endian
+    CHECK(p[7] == 0x80 && p[8] == 0x00);                 // gyro X
+    CHECK(p[14] == 0x12 && p[15] == 0x34);               // timestamp last
+
+    ICM426xx_SampleRaw r;
+    fifo_t_valid = false;
+    CHECK_EQ(ICM426xx_FifoParseRaw(p, sizeof p, &r, 1), 1);
+    CHECK(r.ax == A[0] && r.ay == A[1] && r.az == A[2]);
+    CHECK(r.gx == G[0] && r.gy == G[1] && r.gz == G[2]);
+    CHECK_EQ(r.accel_fsr_g, ICM426xx_ACCEL_FSR_G);
+    CHECK_EQ(r.gyro_fsr_dps, ICM426xx_GYRO_FSR_DPS);
+    CHECK_EQ(r.ts, 0x1234);
+
+    ICM426xx_Sample s;
+    fifo_t_valid = false;
+    CHECK_EQ(ICM426xx_FifoParse(p, sizeof p, &s, 1), 1);
+    CHECK(s.ax == 1.0f && s.ay == -0.5f);
+    CHECK(s.gx == -250.0f);
+    CHECK_EQ(s.ts, 0x1234);
+}
+
+static void test_timestamp_unwrap(void)
+{
+    uint8_t buf[4 * ICM426xx_FIFO_PACKET_LEN];
+    const uint16_t t16[4] = { 64000, 65000, 464, 1464 };   // wraps between 2 and 3
+    for (int i = 0; i < 4; ++i) icm_packet3(buf + 16 * i, A, G, 25, t16[i]);
+
+    ICM426xx_SampleRaw r[4];
+    fifo_t_valid = false;
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 4), 4);
+    CHECK_EQ(r[0].ts, 64000);
+    CHECK_EQ(r[1].ts, 65000);
+    CHECK_EQ(r[2].ts, 66000);
+    CHECK_EQ(r[3].ts, 67000);
+
+    // a later batch carries on from the last timestamp
+    icm_packet3(buf, A, G, 25, 2464);
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, 16, r, 1), 1);
+    CHECK_EQ(r[0].ts, 68000);
+}
+
+// Packet 4 (HEADER_20): 2-byte temperature, so the timestamp is one byte on
+static void test_packet4_timestamp(void)
+{
+    uint8_t p[2 * ICM426xx_FIFO_PACKET_LEN];
+    memset(p, 0, sizeof p);
+    icm_packet3(p, A, G, 0, 0);
+    p[0] = 0x78;                                         // HEADER_20
+    p[13] = 0x0A; p[14] = 0xBC;                          // temperature
+    p[15] = 0x43; p[16] = 0x21;                          // timestamp
+
+    ICM426xx_SampleRaw r;
+    fifo_t_valid = false;
+    CHECK_EQ(ICM426xx_FifoParseRaw(p, sizeof p, &r, 1), 1);
+    CHECK(r.ax == A[0] && r.gz == G[2]);
+    CHECK_EQ(r.ts, 0x4321);
+    CHECK_EQ(ICM426xx_FifoParseRaw(p, 19, &r, 1), 0);   // truncated
+}
+
+static void test_empty_and_invalid_header(void)
+{
+    uint8_t buf[2 * ICM426xx_FIFO_PACKET_LEN];
+    ICM426xx_SampleRaw r[2];
+
+    memset(buf, 0, sizeof buf);
+    buf[0] = 0x80;                                       // HEADER_MSG: FIFO empty
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 2), 0);
+    memset(buf, 0xFF, sizeof buf);                       // what an empty FIFO_DATA reads
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 2), 0);
+    memset(buf, 0, sizeof buf);                          // neither accel nor gyro
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 2), 0);
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, 0, r, 2), 0);
+
+    // a good packet, then an empty marker: only the first counts
+    icm_packet3(buf, A, G, 25, 100);
+    buf[16] = 0x80;
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 2), 1);
+    CHECK_EQ(r[0].ax, A[0]);
+}
+
+static void test_partial_trailing_packet(void)
+{
+    uint8_t buf[3 * ICM426xx_FIFO_PACKET_LEN];
+    int16_t a[3] = { 0, 0, 0 };
+    for (int i = 0; i < 3; ++i) {
+        a[0] = (int16_t)(1000 * (i + 1));
+        icm_packet3(buf + 16 * i, a, G, 25, (uint16_t)(10 * i));
+    }
+
+    ICM426xx_SampleRaw r[3];
+    fifo_t_valid = false;
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf - 5, r, 3), 2);
+    CHECK(r[0].ax == 1000 && r[1].ax == 2000);
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, 15, r, 3), 0);
+    CHECK_EQ(ICM426xx_FifoParseRaw(buf, sizeof buf, r, 2), 2);  // max caps it too
+}
+
+static void push_records(int n, int16_t first)
+{
+    uint8_t p[ICM426xx_FIFO_PACKET_LEN];
+    int16_t a[3] = { 0, 0, 16384 };
+    for (int i = 0; i < n; ++i) {
+        a[0] = (int16_t)(first + i);
+        icm_packet3(p, a, G, 25, (uint16_t)(5000 * (first + i)));
+        icm_fifo_push(p, sizeof p);
+    }
+}
+
+static void test_watermark(void)
+{
+    bring_up();
+    push_records(3, 0);                                  // stale: the enable flushes it
+    ICM426xx_FifoEnable(ICM426xx_FIFO_WATERMARK);
+    CHECK_EQ(icm_fifo_bytes(), 0);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG2], ICM426xx_FIFO_WATERMARK);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG3], 0);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG1], 0x27);
+    CHECK_EQ(icm_regs[0][B0_INTF_CONFIG0], 0x70);        // FIFO_COUNT in records
+    CHECK_EQ(icm_regs[0][B0_INT_SOURCE0], 0x04);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG], 0x40);
+
+    ICM426xx_FifoEnable(0);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG2], 1);
+    ICM426xx_FifoEnable(300);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG2], ICM426xx_FIFO_BATCH_MAX);
+    CHECK_EQ(icm_regs[0][B0_FIFO_CONFIG3], 0);
+
+    // the record count the driver reads back, then one capped batch
+    ICM426xx_FifoEnable(ICM426xx_FIFO_WATERMARK);
+    push_records(40, 0);
+    const uint8_t *cnt = read_burst(B0_FIFO_COUNTH, 2);
+    CHECK_EQ((cnt[0] << 8) | cnt[1], 40);
+
+    ICM426xx_Sample out[64];
+    CHECK_EQ(ICM426xx_FifoRead(out, 64), ICM426xx_FIFO_BATCH_MAX);
+    CHECK_EQ(icm_fifo_bytes(), 8 * ICM426xx_FIFO_PACKET_LEN);
+    for (int i = 0; i < ICM426xx_FIFO_BATCH_MAX; ++i) CHECK_EQ(out[i].ts, 5000 * i);
+    CHECK_EQ(ICM426xx_FifoRead(out, 5), 5);
+    CHECK_EQ(out[4].ts, 5000 * 36);
+
+    // the rest over DMA: count, then data chained from its completion
+    CHECK(ICM426xx_FifoReadAsync());
+    CHECK(!ICM426xx_FifoReadAsync());                    // one transfer at a time
+    CHECK_EQ(ICM426xx_FifoCollect(out, 64), 0);          // nothing landed yet
+    int completions = 0;
+    while (icm_mock_dma_complete(true)) completions++;
+    CHECK_EQ(completions, 2);
+    CHECK_EQ(ICM426xx_FifoCollect(out, 64), 3);
+    CHECK_EQ(out[2].ts, 5000 * 39);
+    CHECK_EQ(icm_fifo_bytes(), 0);
+
+    // an empty FIFO ends after the count, with nothing to collect
+    CHECK(ICM426xx_FifoReadAsync());
+    CHECK(icm_mock_dma_complete(true));
+    CHECK(!icm_mock_dma_complete(true));
+    CHECK_EQ(ICM426xx_FifoCollect(out, 64), 0);
+    CHECK(!ICM426xx_XferBusy());
+}
+
+static uint16_t drain_raw(ICM426xx_SampleRaw *out, uint16_t max)
+{
+    if (!ICM426xx_FifoReadAsync()) return 0;
+    while (icm_mock_dma_complete(true)) { }
+    return ICM426xx_FifoCollectRaw(out, max);
+}
+
+// However late a batch is drained, ts is the sensor's time of sampling
+static void test_stream_timestamps(void)
+{
+    bring_up();
+    ICM426xx_FifoEnable(4);
+    CHECK_EQ(icm_regs[0][B0_TMST_CONFIG] & 0x09, 0x01);  // TMST_EN, 1 us resolution
+
+    ICM426xx_SampleRaw out[ICM426xx_FIFO_BATCH_MAX];
+    const uint32_t service_ms[3] = { 3, 41, 7 };         // late and uneven reads
+    int k = 0;
+    for (int b = 0; b < 3; ++b) {
+        push_records(4 + 6 * b, (int16_t)k);
+        host_tick += service_ms[b];
+        uint16_t n = drain_raw(out, ICM426xx_FIFO_BATCH_MAX);
+        CHECK_EQ(n, 4 + 6 * b);
+        for (uint16_t i = 0; i < n; ++i, ++k) {
+            CHECK_EQ(out[i].ax, k);
+            CHECK_EQ(out[i].ts, 5000 * k);                // 200 Hz, past 16-bit wraps
+        }
+    }
+    CHECK_EQ(ICM426xx_valueRaw().ts, 5000 * (k - 1));
+
+    // an uncollected batch is kept: no second drain over it
+    push_records(2, (int16_t)k);
+    CHECK(ICM426xx_FifoReadAsync());
+    while (icm_mock_dma_complete(true)) { }
+    push_records(2, (int16_t)(k + 2));
+    CHECK(!ICM426xx_FifoReadAsync());
+    CHECK_EQ(ICM426xx_FifoCollectRaw(out, ICM426xx_FIFO_BATCH_MAX), 2);
+    CHECK_EQ(out[1].ts, 5000 * (k + 1));
+    CHECK_EQ(drain_raw(out, ICM426xx_FIFO_BATCH_MAX), 2);
+    CHECK_EQ(out[1].ts, 5000 * (k + 3));
+
+    // re-enabling drops a stale batch and restarts the timestamp
+    push_records(1, 0);
+    CHECK(ICM426xx_FifoReadAsync());
+    while (icm_mock_dma_complete(true)) { }
+    ICM426xx_FifoEnable(4);
+    CHECK_EQ(ICM426xx_FifoCollectRaw(out, ICM426xx_FIFO_BATCH_MAX), 0);
+    push_records(1, 3);
+    CHECK_EQ(drain_raw(out, ICM426xx_FIFO_BATCH_MAX), 1);
+    CHECK_EQ(out[0].ts, 15000);
+}
+
+static void test_profile_settle(void)
+{
+    icm_mock_reset();
+    ICM426xx_InitStart();
+    CHECK_EQ(ICM426xx_GetProfile(), ICM426xx_PROFILE_COUNT);
+    ICM426xx_SetProfile(ICM426xx_PROFILE_LN_200);        // not ready: ignored
+    CHECK_EQ(icm_regs[0][B0_PWR_MGMT0], 0);
+    while (!ICM426xx_InitStep()) host_tick++;
+    CHECK_EQ(ICM426xx_GetProfile(), ICM426xx_PROFILE_APEX);
+    CHECK(ICM426xx_Settled());
+
+    ICM426xx_FifoEnable(4);
+    ICM426xx_SetProfile(ICM426xx_PROFILE_LN_200);        // gyro off → on
+    CHECK_EQ(icm_regs[0][B0_PWR_MGMT0], 0x0F);
+    uint32_t t0 = host_tick;
+    ICM426xx_Sample out[ICM426xx_FIFO_BATCH_MAX];
+    int k = 0;
+    while (!ICM426xx_Settled()) {                        // start-up samples go to nobody
+        push_records(1, (int16_t)k++);
+        CHECK(!ICM426xx_FifoReadAsync());
+        CHECK_EQ(ICM426xx_FifoRead(out, ICM426xx_FIFO_BATCH_MAX), 0);
+        host_tick++;
+    }
+    CHECK(host_tick - t0 >= ICM426xx_GYRO_STARTUP_MS);
+    CHECK(host_tick - t0 <= ICM426xx_GYRO_STARTUP_MS + 2);
+    CHECK_EQ(icm_fifo_bytes(), 0);                       // flushed at the deadline
+
+    push_records(2, 100);
+    CHECK_EQ(ICM426xx_FifoRead(out, ICM426xx_FIFO_BATCH_MAX), 2);
+    CHECK_EQ(out[0].ts, (uint16_t)(5000 * 100));         // chain restarted
+    CHECK_EQ(out[1].ts - out[0].ts, 5000);
+
+    ICM426xx_SetProfile(ICM426xx_PROFILE_APEX);          // gyro off: nothing to wait for
+    CHECK(ICM426xx_Settled());
+    ICM426xx_SetProfile(ICM426xx_PROFILE_OFF);
+    CHECK_EQ(icm_regs[0][B0_PWR_MGMT0], 0x00);
+    CHECK(ICM426xx_Settled());
+    ICM426xx_SetProfile(ICM426xx_PROFILE_ACCEL_LP_50);   // accel off → on
+    CHECK_EQ(icm_regs[0][B0_ACCEL_CONFIG0], 0x69);
+    t0 = host_tick;
+    while (!ICM426xx_Settled()) host_tick++;
+    CHECK(host_tick - t0 >= ICM426xx_ACCEL_STARTUP_MS);
+    CHECK(host_tick - t0 <= ICM426xx_ACCEL_STARTUP_MS + 2);
+    CHECK_EQ(ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_OFF), 8);
+    ICM426xx_SetProfile(ICM426xx_PROFILE_APEX);
+    ICM426xx_SetProfile(ICM426xx_PROFILE_COUNT);
+    CHECK_EQ(ICM426xx_GetProfile(), ICM426xx_PROFILE_APEX);
+    CHECK_EQ(ICM426xx_ProfileCurrent_uA(ICM426xx_PROFILE_COUNT), 0);
+}
+
+int main(void)
+{
+    test_packet3_layout();
+    test_timestamp_unwrap();
+    test_packet4_timestamp();
+    test_empty_and_invalid_header();
+    test_partial_trailing_packet();
+    test_watermark();
+    test_stream_timestamps();
+    test_profile_settle();
+    HOST_TEST_END();
+}
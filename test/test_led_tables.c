@@ -0,0 +1,150 @@
+// Re-checks every table gen_led_tables.py emits, as the compiler sees them,
+// and drives each pixel through the scan path's register images. Built once
+// for the committed round15 tables and once per board generated in the
+// build tree (see CMakeLists.txt).
+#include "led_driver.c"
+#include "host_test.h"
+
+static int pin_of(GPIO_TypeDef *port, uint8_t pos)
+{
+    for (int i = 0; i < N_PINS; ++i)
+        if (pins[i].port == port && pins[i].pos == pos) return i;
+    return -1;
+}
+
+static void test_pins(void)
+{
+    for (int i = 0; i < N_PINS; ++i) {
+        CHECK(pins[i].pos < 16);
+        CHECK_EQ(pins[i].pinmask, 1u << pins[i].pos);
+        CHECK_EQ(pin_of(pins[i].port, pins[i].pos), i);     // no GPIO listed twice
+        int in_ports = 0;
+        for (int k = 0; k < LED_N_PORTS; ++k) in_ports += LED_PORTS[k] == pins[i].port;
+        CHECK_EQ(in_ports, 1);
+    }
+}
+
+static void test_steps_and_scan(void)
+{
+    static uint8_t pair_seen[N_PINS][N_PINS];
+    int n_valid = 0;
+
+    for (int i = 0; i < N_PIXELS; ++i) {
+        CP_Step st = STEPS[i];
+        ScanEntry e = LED_SCAN[i];
+        CHECK_EQ(e.idx, i);
+        if (!VALID_MASK[i]) {
+            CHECK(st.hi == 0 && st.lo == 0);
+            CHECK_EQ(e.hi, LED_NO_PAIR);
+            CHECK_EQ(e.lo, LED_NO_PAIR);
+            continue;
+        }
+        CHECK(st.hi < N_PINS && st.lo < N_PINS && st.hi != st.lo);
+        CHECK(e.hi == st.hi && e.lo == st.lo);
+        if (st.hi < N_PINS && st.lo < N_PINS) {
+            CHECK_EQ(pair_seen[st.hi][st.lo], 0);             // no two pixels on one pin pair
+            pair_seen[st.hi][st.lo] = 1;
+        }
+        CHECK_EQ(LED_VALID_PIX[n_valid], i);                  // ascending, one per valid pixel
+        n_valid++;
+    }
+    CHECK_EQ(n_valid, LED_N_VALID);
+}
+
+static void test_row_span(void)
+{
+    for (int r = 0; r < ROWS; ++r) {
+        int first = COLS, last = 0;
+        for (int c = 0; c < COLS; ++c)
+            if (VALID_MASK[r * COLS + c]) { if (first == COLS) first = c; last = c; }
+        CHECK_EQ(LED_ROW_SPAN[r][0], first);
+        CHECK_EQ(LED_ROW_SPAN[r][1], last);
+    }
+}
+
+static void test_curves(void)
+{
+    CHECK_EQ(LED_GAMMA_Q16[0], 0);
+    CHECK_EQ(LED_GAMMA_Q16[255], 65535);
+    CHECK_EQ(LED_AA_LEVEL[0], 0);
+    CHECK_EQ(LED_AA_LEVEL[255], 255);
+    for (int i = 1; i < 256; ++i) {
+        CHECK(LED_GAMMA_Q16[i] >= LED_GAMMA_Q16[i - 1]);
+        CHECK(LED_AA_LEVEL[i] >= LED_AA_LEVEL[i - 1]);
+    }
+    // AA level is the inverse of the gamma: its light output is coverage/255
+    for (int cov = 1; cov < 256; ++cov) {
+        uint8_t lv = LED_AA_LEVEL[cov];
+        uint32_t want = (uint32_t)cov * 65535u / 255u;
+        uint32_t lo = lv ? LED_GAMMA_Q16[lv - 1] : 0, hi = lv < 255 ? LED_GAMMA_Q16[lv + 1] : 65535u;
+        CHECK(lo <= want && want <= hi);
+    }
+}
+
+// Every valid pixel through drive_pixel: exactly its two pins become outputs,
+// anode set and cathode reset; release_last puts everything back to Hi-Z.
+static void test_gpio_images(void)
+{
+    for (int i = 0; i < N_PIXELS; ++i) {
+        const LedGpio *g = &LED_GPIO[i];
+        if (!VALID_MASK[i]) {
+            for (int k = 0; k < LED_N_PORTS; ++k) CHECK(g->moder[k] == 0 && g->bsrr[k] == 0);
+            continue;
+        }
+        const Pin *hi = &pins[STEPS[i].hi], *lo = &pins[STEPS[i].lo];
+
+        for (int k = 0; k < LED_N_PORTS; ++k) { LED_PORTS[k]->MODER = 0; LED_PORTS[k]->BSRR = 0; }
+        drive_pixel((uint16_t)i);
+
+        int outputs = 0;
+        for (int k = 0; k < LED_N_PORTS; ++k)
+            for (uint8_t b = 0; b < 16; ++b) {
+                uint32_t mode = (LED_PORTS[k]->MODER >> (2 * b)) & 3u;
+                CHECK(mode == 0 || mode == 1);
+                if (mode == 1) {
+                    outputs++;
+                    CHECK((LED_PORTS[k] == hi->port && b == hi->pos) ||
+                          (LED_PORTS[k] == lo->port && b == lo->pos));
+                }
+            }
+        CHECK_EQ(outputs, 2);
+        CHECK(hi->port->BSRR & (1u << hi->pos));
+        CHECK(lo->port->BSRR & (1u << (lo->pos + 16)));
+        CHECK_EQ(hi->port->BSRR & (1u << (hi->pos + 16)), 0);
+        CHECK_EQ(lo->port->BSRR & (1u << lo->pos), 0);
+
+        release_last();
+        for (int k = 0; k < LED_N_PORTS; ++k) CHECK_EQ(LED_PORTS[k]->MODER & MODER_OUT_BITS, 0);
+    }
+}
+
+static void test_face(void)
+{
+    CHECK_EQ(FACE_OFS[0], 0);
+    CHECK_EQ(FACE_OFS[FACE_HANDS * FACE_POS], sizeof FACE_PX / sizeof FACE_PX[0]);
+    for (int h = 0; h < FACE_HANDS * FACE_POS; ++h) {
+        CHECK(FACE_OFS[h + 1] > FACE_OFS[h]);                 // every position lights something
+        for (int j = FACE_OFS[h]; j < FACE_OFS[h + 1]; ++j) {
+            CHECK(FACE_PX[j].idx < N_PIXELS);
+            CHECK(VALID_MASK[FACE_PX[j].idx]);
+            CHECK(FACE_PX[j].level > 0);
+            for (int k = FACE_OFS[h]; k < j; ++k) CHECK(FACE_PX[k].idx != FACE_PX[j].idx);
+        }
+    }
+    for (int m = 0; m < FACE_MARKS_N; ++m) {
+        CHECK(VALID_MASK[FACE_MARKS[m]]);
+        for (int k = 0; k < m; ++k) CHECK(FACE_MARKS[k] != FACE_MARKS[m]);
+    }
+}
+
+int main(void)
+{
+    printf("board %s: %dx%d, %d pins, %d LEDs\n", LED_BOARD, ROWS, COLS, N_PINS, LED_N_VALID);
+    test_pins();
+    test_steps_and_scan();
+    test_row_span();
+    test_curves();
+    test_gpio_images();
+    test_face();
+    HOST_TEST_END();
+}
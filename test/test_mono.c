@@ -0,0 +1,193 @@
+// Mono plane blits and Led_DrawClock against the old per-pixel renderer,
+// plus a host benchmark of both clock paths.
+#include "led_driver.c"
+#include "host_test.h"
+
+static uint8_t px(int r, int c) { return fb[r * COLS + c]; }
+
+// Pre-mono clock: one Display_SetPixelRC per glyph bit, zeros included
+static void ref_digit(uint8_t r0, uint8_t c0, int d, uint8_t level)
+{
+    for (uint8_t ry = 0; ry < HEX_H; ++ry) {
+        uint8_t row = HEX_3x5[d][ry];
+        for (uint8_t rx = 0; rx < HEX_W; ++rx) {
+            uint8_t bit = (row >> (HEX_W - 1 - rx)) & 1u;
+            uint8_t rr = r0 + ry, cc = c0 + rx;
+            if (rr < ROWS && cc < COLS)
+                Display_SetPixelRC(rr, cc, bit ? level : 0);
+        }
+    }
+}
+
+static void ref_draw_clock(uint8_t hh, uint8_t mm, uint8_t ss)
+{
+    Display_Clear();
+    uint8_t h = hh % 12;
+    if (h == 0) h = 12;
+    uint8_t h10 = h / 10, h1 = h % 10, m10 = mm / 10, m1 = mm % 10;
+    bool colon_on = ((ss & 1u) == 0);
+    int8_t shift = (h10 == 0) ? -(HEX_W + 1)/2 : 0;
+
+    if (h10 == 0) {
+        for (uint8_t ry = 0; ry < HEX_H; ++ry)
+            for (uint8_t rx = 0; rx < HEX_W; ++rx)
+                Display_SetPixelRC(ROW0 + ry, COL_D0 + rx + shift, 0);
+    } else {
+        ref_digit(ROW0, COL_D0 + shift, h10, TIME_LEVEL);
+    }
+    ref_digit(ROW0, COL_D1 + shift, h1 , TIME_LEVEL);
+    ref_digit(ROW0, COL_D2 + shift, m10, TIME_LEVEL);
+    ref_digit(ROW0, COL_D3 + shift, m1 , TIME_LEVEL);
+    Display_SetPixelRC(ROW0 + 1, COL_COLON + shift, colon_on ? TIME_LEVEL : 0);
+    Display_SetPixelRC(ROW0 + 3, COL_COLON + shift, colon_on ? TIME_LEVEL : 0);
+
+    uint8_t sec_row = ROW0 + HEX_H + 1;
+    uint8_t sec_col = (COLS - (3*2 + 1)) / 2;
+    ref_digit(sec_row, sec_col, ss / 10, TIME_LEVEL);
+    ref_digit(sec_row, sec_col + 4, ss % 10, TIME_LEVEL);
+}
+
+// fb matches the active list, pos_map and the load sum
+static void check_fb_consistent(void)
+{
+    int lit = 0;
+    uint32_t load = 0;
+    for (int i = 0; i < N_PIXELS; ++i) {
+        if (fb[i] && VALID_MASK[i]) lit++;
+        if (VALID_MASK[i]) load += LED_GAMMA_Q16[fb[i]];
+    }
+    CHECK_EQ(act_len, lit);
+    CHECK_EQ(fb_load, load);
+    for (int i = 0; i < act_len; ++i) {
+        CHECK_EQ(pos_map[act[i].idx], i);
+        CHECK(fb[act[i].idx] != 0);
+    }
+}
+
+static void test_blit_ops(void)
+{
+    const uint8_t *eight = HEX_3x5[8];
+
+    Display_Clear();
+    Mono_Clear();
+    Mono_Blit(2, 4, eight, HEX_W, HEX_H, MONO_OR);
+    Mono_Commit(200);
+    for (int r = 0; r < ROWS; ++r)
+        for (int c = 0; c < COLS; ++c) {
+            bool in  = r >= 2 && r < 2 + HEX_H && c >= 4 && c < 4 + HEX_W;
+            bool bit = in && ((eight[r - 2] >> (HEX_W - 1 - (c - 4))) & 1u);
+            CHECK_EQ(px(r, c), bit ? 200 : 0);
+        }
+    check_fb_consistent();
+
+    // solid box AND-NOT glyph leaves the glyph's zero bits
+    Mono_Clear();
+    Mono_Blit(2, 4, NULL, HEX_W, HEX_H, MONO_OR);
+    Mono_Blit(2, 4, HEX_3x5[0], HEX_W, HEX_H, MONO_ANDNOT);
+    Mono_Commit(200);
+    CHECK_EQ(px(3, 5), 200);               // centre hole of the 0
+    CHECK_EQ(px(2, 4), 0);
+    CHECK_EQ(px(6, 6), 0);
+    check_fb_consistent();
+
+    // XOR twice is a no-op; COPY replaces only inside its box
+    Mono_Clear();
+    Mono_Blit(0, 0, NULL, COLS, 1, MONO_OR);
+    Mono_Blit(0, 3, eight, HEX_W, 1, MONO_XOR);
+    Mono_Blit(0, 3, eight, HEX_W, 1, MONO_XOR);
+    CHECK_EQ(mono[0], MONO_COLS_MASK);
+    Mono_Blit(0, 3, HEX_3x5[1], HEX_W, 1, MONO_COPY);   // row 0 of "1" is .#.
+    CHECK_EQ(mono[0], MONO_COLS_MASK & ~(mono_row_t)((MONO_MSB >> 3) | (MONO_MSB >> 5)));
+}
+
+static void test_blit_clipping(void)
+{
+    Mono_Clear();
+    Mono_Blit(-2, -1, HEX_3x5[8], HEX_W, HEX_H, MONO_OR);        // top-left corner
+    Mono_Blit(ROWS - 2, COLS - 2, HEX_3x5[8], HEX_W, HEX_H, MONO_OR);
+    CHECK_EQ(mono[0], (mono_row_t)((MONO_MSB | (MONO_MSB >> 1))));     // "#.#" row 2, col -1 cut
+    CHECK_EQ(mono[ROWS - 2], (mono_row_t)((MONO_MSB >> (COLS - 2)) | (MONO_MSB >> (COLS - 1))));
+    for (int r = 0; r < ROWS; ++r)
+        CHECK_EQ(mono[r] & (mono_row_t)~MONO_COLS_MASK, 0);
+
+    // wholly off the board, however far: nothing drawn, no oversized shift
+    Mono_Clear();
+    const int8_t off[] = { COLS, 100, 127, -HEX_W, -40, -128 };
+    for (unsigned i = 0; i < sizeof off; ++i)
+        Mono_Blit(0, off[i], HEX_3x5[8], HEX_W, HEX_H, MONO_OR);
+    for (int r = 0; r < ROWS; ++r)
+        CHECK_EQ(mono[r], 0);
+
+    uint16_t cols[4] = { 0x1F, 0x01, 0x10, 0x1F };
+    Mono_Clear();
+    Mono_BlitCols(0, COLS - 2, cols, 4, 5, MONO_OR);              // two columns fall off
+    CHECK_EQ(mono[0], (mono_row_t)((MONO_MSB >> (COLS - 2)) | (MONO_MSB >> (COLS - 1))));
+    CHECK_EQ(mono[4], (mono_row_t)(MONO_MSB >> (COLS - 2)));
+}
+
+static void test_commit_incremental(void)
+{
+    Display_Clear();
+    Led_DrawClock(10, 48, 2);
+    Display_PixelsTouched();
+
+    // 10:48:02 → 10:48:03: colon off and the last seconds digit change
+    uint16_t diff = 0;
+    uint8_t before[N_PIXELS];
+    for (int i = 0; i < N_PIXELS; ++i) before[i] = fb[i];
+    Led_DrawClock(10, 48, 3);
+    for (int i = 0; i < N_PIXELS; ++i) diff += before[i] != fb[i];
+    CHECK(diff > 0);
+    CHECK_EQ(Display_PixelsTouched(), diff);
+    check_fb_consistent();
+
+    // a stray SetPixelRC is repaired by the next commit
+    Display_SetPixelRC(0, 7, 9);
+    Led_DrawClock(10, 48, 3);
+    CHECK_EQ(px(0, 7), 0);
+    check_fb_consistent();
+}
+
+static void test_clock_matches_reference(void)
+{
+    uint8_t ref[N_PIXELS];
+    static const uint8_t HH[] = { 0, 1, 9, 10, 12, 23 };
+    for (unsigned i = 0; i < sizeof HH; ++i)
+        for (uint8_t mm = 0; mm < 60; mm += 7)
+            for (uint8_t ss = 0; ss < 60; ss += 13) {
+                ref_draw_clock(HH[i], mm, ss);
+                for (int p = 0; p < N_PIXELS; ++p) ref[p] = fb[p];
+                Led_DrawClock(HH[i], mm, ss);
+                int bad = 0;
+                for (int p = 0; p < N_PIXELS; ++p) bad += ref[p] != fb[p];
+                CHECK_EQ(bad, 0);
+                check_fb_consistent();
+            }
+}
+
+static void bench_draw_clock(void)
+{
+    enum { N = 20000 };
+    uint64_t t0 = host_ns();
+    for (int i = 0; i < N; ++i) ref_draw_clock(12, 34, (uint8_t)(i % 60));
+    uint64_t t1 = host_ns();
+    for (int i = 0; i < N; ++i) Led_DrawClock(12, 34, (uint8_t)(i % 60));
+    uint64_t t2 = host_ns();
+    // 7 glyphs per clock (4 digits, colon, 2 seconds digits)
+    printf("Led_DrawClock: per-pixel %.0f ns, mono %.0f ns per redraw (%.1f / %.1f ns per glyph)\n",
+           (double)(t1 - t0) / N, (double)(t2 - t1) / N,
+           (double)(t1 - t0) / N / 7, (double)(t2 - t1) / N / 7);
+}
+
+int main(void)
+{
+    htim2.Instance->ARR = 1199;
+    Led_Init();
+
+    test_blit_ops();
+    test_blit_clipping();
+    test_commit_incremental();
+    test_clock_matches_reference();
+    bench_draw_clock();
+    HOST_TEST_END();
+}
@@ -0,0 +1,163 @@
+// Text strips: layout widths, glyph columns, truncation, windowing and the
+// marquee run, plus a host benchmark of one scrolled frame against
+// redrawing every glyph per pixel.
+#include "led_driver.c"
+#include "text.c"
+#include "host_test.h"
+
+// Independent transpose: rows (MSB = leftmost) → column x, bit r = row r
+static uint16_t ref_col(const uint8_t *rows, uint8_t w, uint8_t h, uint8_t x)
+{
+    uint16_t bits = 0;
+    for (uint8_t r = 0; r < h; ++r)
+        if (rows[r] & (1u << (w - 1u - x))) bits |= (uint16_t)(1u << r);
+    return bits;
+}
+
+static bool mono_px(int r, int c) { return (mono[r] & (MONO_MSB >> c)) != 0; }
+
+static void test_widths(void)
+{
+    CHECK_EQ(Text_Width("", TEXT_FONT_PROP), 0);
+    CHECK_EQ(Text_Width("I", TEXT_FONT_PROP), 1);
+    CHECK_EQ(Text_Width("MI", TEXT_FONT_PROP), 5 + TEXT_GAP + 1);
+    CHECK_EQ(Text_Width("mi", TEXT_FONT_PROP), Text_Width("MI", TEXT_FONT_PROP));   // folded
+    CHECK_EQ(Text_Width("~", TEXT_FONT_PROP), Text_Width("?", TEXT_FONT_PROP));     // unknown → '?'
+    CHECK_EQ(Text_Width("12", TEXT_FONT_HEX_3x5), 2 * HEX_W + TEXT_GAP);
+    CHECK_EQ(Text_Width("1x2", TEXT_FONT_TINY_4x3), 2 * TINY_W + TEXT_GAP);         // x has no glyph
+    CHECK_EQ(Text_Width("1:2", TEXT_FONT_TINY_4x3), 2 * TINY_W + 1 + 2 * TEXT_GAP);
+
+    uint16_t buf[128];
+    Text_Strip s = { buf, 128, 0, 0 };
+    const char *str = "18 OCT 12345 STEPS";
+    CHECK_EQ(Text_Render(&s, str, TEXT_FONT_PROP), Text_Width(str, TEXT_FONT_PROP));
+    CHECK_EQ(s.h, 5);
+    Text_Render(&s, "12", TEXT_FONT_TINY_4x3);
+    CHECK_EQ(s.h, TINY_H);
+}
+
+static void test_glyph_columns(void)
+{
+    uint16_t buf[32];
+    Text_Strip s = { buf, 32, 0, 0 };
+
+    Text_Render(&s, "1A", TEXT_FONT_HEX_3x5);
+    for (uint8_t x = 0; x < HEX_W; ++x) {
+        CHECK_EQ(buf[x], ref_col(HEX_3x5[1], HEX_W, HEX_H, x));
+        CHECK_EQ(buf[HEX_W + TEXT_GAP + x], ref_col(HEX_3x5[10], HEX_W, HEX_H, x));
+    }
+    CHECK_EQ(buf[HEX_W], 0);                                 // the gap
+
+    Text_Render(&s, "7", TEXT_FONT_TINY_4x3);
+    for (uint8_t x = 0; x < TINY_W; ++x)
+        CHECK_EQ(buf[x], ref_col(TINY_4x3[7], TINY_W, TINY_H, x));
+
+    Text_Render(&s, "W", TEXT_FONT_PROP);
+    CHECK_EQ(s.len, 5);
+    for (uint8_t x = 0; x < 5; ++x) CHECK_EQ(buf[x], PROP_5['W' - PROP_FIRST].col[x]);
+}
+
+static void test_truncation(void)
+{
+    uint16_t buf[8];
+    for (int i = 0; i < 8; ++i) buf[i] = 0xBEEF;
+    Text_Strip s = { buf, 5, 0, 0 };
+    CHECK_EQ(Text_Render(&s, "HELLO", TEXT_FONT_PROP), 5);
+    for (int i = 5; i < 8; ++i) CHECK_EQ(buf[i], 0xBEEF);    // nothing past cap
+}
+
+static void test_show_window(void)
+{
+    uint16_t buf[64];
+    Text_Strip s = { buf, 64, 0, 0 };
+    Text_Render(&s, "8888", TEXT_FONT_HEX_3x5);              // 15 columns, 5 rows
+    const int r0 = 4;
+
+    for (int x = -COLS; x <= s.len; ++x) {
+        Mono_Clear();
+        Text_Show(&s, (int16_t)x, r0);
+        for (int r = 0; r < ROWS; ++r)
+            for (int c = 0; c < COLS; ++c) {
+                int sx = x + c;                              // strip column under screen c
+                bool want = r >= r0 && r < r0 + s.h && sx >= 0 && sx < s.len &&
+                            (buf[sx] >> (r - r0)) & 1u;
+                CHECK_EQ(mono_px(r, c), want);
+            }
+    }
+}
+
+static int marquee_done_calls;
+static void on_marquee_done(void) { marquee_done_calls++; }
+
+static void test_marquee_run(void)
+{
+    Display_Clear();
+    host_tick = 1000;
+    const uint16_t cps = 50;
+    CHECK(Text_Marquee("HI", TEXT_FONT_PROP, 5, 200, cps, on_marquee_done));
+    CHECK(Text_MarqueeBusy());
+
+    bool lit_seen = false;
+    uint32_t end = host_tick + ((Text_Width("HI", TEXT_FONT_PROP) + COLS) * 1000u) / cps + 100u;
+    while (host_tick < end) {
+        host_tick += 5;
+        Anim_Tick(host_tick);
+        for (int i = 0; i < N_PIXELS; ++i) lit_seen |= fb[i] != 0;
+    }
+    CHECK(lit_seen);
+    CHECK(!Text_MarqueeBusy());
+    CHECK_EQ(marquee_done_calls, 1);
+    for (int i = 0; i < N_PIXELS; ++i) CHECK_EQ(fb[i], 0);   // scrolled fully off
+}
+
+// The per-pixel way: every frame re-lays out and plots every glyph bit
+static void ref_scroll_frame(const char *str, int16_t x, int8_t r0, uint8_t level)
+{
+    Display_Clear();
+    int c = -x;
+    for (const char *p = str; *p; ++p) {
+        uint8_t col[GLYPH_MAX_W];
+        uint8_t w = prop_glyph(*p, col);
+        for (uint8_t gx = 0; gx < w; ++gx, ++c)
+            for (uint8_t r = 0; r < 5; ++r)
+                if (c >= 0 && c < COLS)
+                    Display_SetPixelRC((uint8_t)(r0 + r), (uint8_t)c, (col[gx] >> r) & 1u ? level : 0);
+        c += TEXT_GAP;
+    }
+}
+
+static void bench_scroll(void)
+{
+    const char *str = "18 OCT  12345 STEPS";
+    const int8_t r0 = 5;
+    Text_Render(&marquee, str, TEXT_FONT_PROP);
+    marquee_r0 = r0;
+    marquee_level = 255;
+
+    enum { REPS = 200 };
+    uint32_t frames = 0;
+    uint64_t t0 = host_ns();
+    for (int k = 0; k < REPS; ++k)
+        for (int16_t x = -COLS; x <= (int16_t)marquee.len; ++x) ref_scroll_frame(str, x, r0, 255);
+    uint64_t t1 = host_ns();
+    for (int k = 0; k < REPS; ++k)
+        for (int16_t x = -COLS; x <= (int16_t)marquee.len; ++x, ++frames) marquee_apply(x);
+    uint64_t t2 = host_ns();
+
+    printf("marquee: per-pixel %.0f ns, strip %.0f ns per scrolled frame (%lu frames)\n",
+           (double)(t1 - t0) / frames, (double)(t2 - t1) / frames, (unsigned long)(frames / REPS));
+}
+
+int main(void)
+{
+    htim2.Instance->ARR = 1199;
+    Led_Init();
+
+    test_widths();
+    test_glyph_columns();
+    test_truncation();
+    test_show_window();
+    test_marquee_run();
+    bench_scroll();
+    HOST_TEST_END();
+}
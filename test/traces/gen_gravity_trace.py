@@ -0,0 +1,110 @@
+# Writes gravity_wrist.csv for test_gravity.c: a synthetic 200 Hz wrist
+# trace with the true gravity direction alongside the sensor LSBs. There is
+# no recording rig for the board yet, so the motion is simulated: a rotation
+# integrated from scheduled body rates, gravity read in sensor axes, hand
+# shakes and jerks added as linear acceleration, then 2 mg / 0.05 dps noise,
+# a fixed gyro bias and the ±2 g / ±250 dps quantisation. A recorded trace
+# with the same columns (truth from an optical or reference IMU) drops in.
+#   python gen_gravity_trace.py [out.csv]
+import math
+import os
+import random
+import sys
+
+FS = 200
+ACCEL_LSB_G = 16384.0
+GYRO_LSB_DPS = 32768.0 / 250.0
+GYRO_BIAS_DPS = (1.0, 0.3, -0.5)
+
+# (start s, end s, label, body rate axis, degrees turned, linear accel)
+#  label: rest / tilt / shake / tilt+shake; accel: None, "shake" or "jerks"
+SEGMENTS = (
+    (0.0,  1.0,  "rest",       None,        0, None),
+    (1.0,  1.6,  "tilt",       (1, 0, 0),  60, None),
+    (1.6,  3.0,  "rest",       None,        0, None),
+    (3.0,  4.0,  "shake",      None,        0, "shake"),
+    (4.0,  5.0,  "rest",       None,        0, None),
+    (5.0,  5.8,  "tilt",       (0, 1, 0), -45, None),
+    (5.8,  6.0,  "rest",       None,        0, None),
+    (6.0,  6.5,  "tilt",       (0, 0, 1),  45, None),   # about the face normal, still tilted
+    (6.5,  7.5,  "rest",       None,        0, None),
+    (7.5,  8.5,  "tilt+shake", (1, 0, 0), -60, "jerks"),
+    (8.5,  9.5,  "shake",      None,        0, "jerks"),
+    (9.5, 11.0,  "rest",       None,        0, None),
+)
+
+
+def rate_at(t):
+    """Body rate (rad/s) and segment at time t: raised-cosine speed profile."""
+    for seg in SEGMENTS:
+        t0, t1, label, axis, deg, lin = seg
+        if t0 <= t < t1:
+            if axis is None:
+                return (0.0, 0.0, 0.0), seg
+            T = t1 - t0
+            w = math.radians(deg) / T * (1.0 - math.cos(2.0 * math.pi * (t - t0) / T))
+            return tuple(w * a for a in axis), seg
+    return (0.0, 0.0, 0.0), SEGMENTS[-1]
+
+
+def lin_accel(seg, t):
+    """Linear acceleration in sensor axes, in g."""
+    lin = seg[5]
+    if lin == "shake":                    # 5 Hz hand shake, mostly along y
+        s = math.sin(2.0 * math.pi * 5.0 * (t - seg[0]))
+        return (0.3 * s, 0.5 * s, 0.1 * s)
+    if lin == "jerks":                    # 60 ms knocks every 250 ms
+        if (t - seg[0]) % 0.25 < 0.06:
+            return (0.0, 0.4, -0.2)
+    return (0.0, 0.0, 0.0)
+
+
+def mat_mul(a, b):
+    return [[sum(a[i][k] * b[k][j] for k in range(3)) for j in range(3)] for i in range(3)]
+
+
+def rot(w, dt):
+    """exp([w dt]x) by Rodrigues."""
+    th = math.sqrt(sum(c * c for c in w)) * dt
+    if th == 0.0:
+        return [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]]
+    k = [c * dt / th for c in w]
+    K = [[0.0, -k[2], k[1]], [k[2], 0.0, -k[0]], [-k[1], k[0], 0.0]]
+    K2 = mat_mul(K, K)
+    s, c = math.sin(th), 1.0 - math.cos(th)
+    return [[(i == j) + s * K[i][j] + c * K2[i][j] for j in range(3)] for i in range(3)]
+
+
+def lsb(v, scale):
+    return max(-32768, min(32767, int(round(v * scale))))
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                                             "gravity_wrist.csv")
+    rng = random.Random(426)
+    R = [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]]   # sensor → world
+    n = int(SEGMENTS[-1][1] * FS)
+    dt = 1.0 / FS
+
+    with open(out, "w", newline="\n") as f:
+        f.write("# synthetic wrist trace, 200 Hz: gen_gravity_trace.py\n")
+        f.write("t_us,ax,ay,az,gx,gy,gz,vx,vy,vz,label\n")
+        for i in range(n):
+            t = i * dt
+            w, _ = rate_at(t - 0.5 * dt)              # mean rate since the last sample
+            _, seg = rate_at(t)
+            R = mat_mul(R, rot(w, dt))
+            v = [R[2][j] for j in range(3)]           # world +z (up) in sensor axes
+            la = lin_accel(seg, t)
+            acc = [v[j] + la[j] + rng.gauss(0.0, 0.002) for j in range(3)]
+            gyr = [math.degrees(w[j]) + GYRO_BIAS_DPS[j] + rng.gauss(0.0, 0.05) for j in range(3)]
+            f.write("%d,%d,%d,%d,%d,%d,%d,%.6f,%.6f,%.6f,%s\n" % (
+                i * 5000,
+                lsb(acc[0], ACCEL_LSB_G), lsb(acc[1], ACCEL_LSB_G), lsb(acc[2], ACCEL_LSB_G),
+                lsb(gyr[0], GYRO_LSB_DPS), lsb(gyr[1], GYRO_LSB_DPS), lsb(gyr[2], GYRO_LSB_DPS),
+                v[0], v[1], v[2], seg[2]))
+
+
+if __name__ == "__main__":
+    main()